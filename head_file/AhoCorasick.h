@@ -0,0 +1,110 @@
+#ifndef __AHOCORASICK_H__
+#define __AHOCORASICK_H__
+
+#include "Object.h"
+#include "String.h"
+#include "StringView.h"
+#include "DynamicArray.h"
+//SharedPointer
+#include "Pointer.h"
+
+/*
+Aho-Corasick多模式匹配自动机
+	在文本中查找k个关键字，逐个调用IndexOf需要扫描文本k遍，复杂度为O(k * n)
+	Aho-Corasick将所有关键字构造成一个自动机，只扫描文本一遍，复杂度为O(n + 匹配的个数)，与关键字的个数无关
+
+构造：
+	1.所有关键字构成一棵字典树（trie），每个节点是一个状态，根节点（状态0）表示空串
+	2.失配指针fail：状态u表示的串的最长真后缀，并且该后缀也是字典树中的状态
+	  按BFS的顺序计算，fail[v] = goto(fail[u], c)，其中v = goto(u, c)
+	3.将失配指针合并到转移表中：goto(u, c)不存在时，goto(u, c) = goto(fail[u], c)
+	  查找时每个字符只需要查一次表，不需要沿着fail回退
+	4.输出链dict：沿着fail链最近的有输出的状态，查找时只访问有输出的状态
+
+字符类压缩（byte class）：
+	稠密转移表每个状态需要256项，状态数为关键字总长度，表会很大，缓存命中率低
+	没有在任何关键字中出现的字节，转移都是一样的（回到根节点），因此将字节映射到字符类：
+		class 0				没有出现在关键字中的字节
+		class 1 ~ C - 1		关键字中出现的字节，按出现的顺序编号
+	转移表为 状态数 * C，对于只包含小写字母的关键字，C = 27，只有256项的1/10
+
+	AhoCorasick ac;
+	ac.Add("error");		//0
+	ac.Add("warn");			//1
+	ac.Build();
+	SharedPointer<Array<AhoCorasick::Match>> m = ac.FindAll(line);
+
+注意：
+	Build之后再Add，需要重新Build，否则查找时抛出异常
+	关键字不能为空串
+	AhoCorasick禁止拷贝：转移表有 状态数 * 字符类数 项，拷贝的代价很高，需要共享时传引用
+*/
+
+namespace YzcLib{
+
+class AhoCorasick: public Object{
+public:
+	//一次匹配：关键字的编号和在文本中的起始位置
+	struct Match: public Object{
+		int pattern;
+		int position;
+	};
+protected:
+	DynamicArray<String> m_patterns;
+	unsigned int m_count;			//关键字的个数
+	unsigned int m_total;			//关键字的总长度
+
+	unsigned short m_class[256];	//字节到字符类的映射，256种字节都出现时共257类
+	unsigned int m_classes;			//字符类的个数C
+	DynamicArray<int> m_next;		//转移表，状态s读入字符类c转移到 m_next[s * C + c]
+	DynamicArray<int> m_out;		//状态对应的关键字编号，没有输出为-1
+	DynamicArray<int> m_dict;		//沿fail链最近的有输出的状态，没有为-1
+	DynamicArray<int> m_same;		//与关键字i相同的下一个关键字，没有为-1
+	unsigned int m_states;
+	bool m_built;
+
+	//状态s的所有输出，返回匹配的个数，rst不为NULL时记录匹配
+	unsigned int _report(int s, int end, DynamicArray<Match>* rst, unsigned int count) const;
+	void _check() const;
+
+	AhoCorasick(const AhoCorasick&);
+	AhoCorasick& operator = (const AhoCorasick&);
+public:
+	AhoCorasick();
+
+	//添加关键字，返回关键字的编号（按添加的顺序从0开始）
+	int Add(const StringView& p);
+	//构造自动机，查找之前必须调用
+	void Build();
+
+	//所有的匹配（包括重叠的匹配），按匹配的结束位置排列，结束位置相同时长的在前
+	SharedPointer<Array<Match>> FindAll(const StringView& text) const;
+	//匹配的个数
+	unsigned int Count(const StringView& text) const;
+	//是否包含任意一个关键字，找到第一个匹配就返回
+	bool Contains(const StringView& text) const;
+
+	unsigned int Patterns() const;
+	unsigned int States() const;
+	unsigned int Classes() const;
+	StringView GetPattern(int i) const;
+};
+
+}
+
+/*
+Test code
+	AhoCorasick ac;
+	ac.Add("he");
+	ac.Add("she");
+	ac.Add("his");
+	ac.Add("hers");
+	ac.Build();
+
+	SharedPointer<Array<AhoCorasick::Match>> m = ac.FindAll("ushers");
+	for(int i = 0; i < m->Length(); i++){
+		cout<<(*m)[i].pattern<<" : "<<(*m)[i].position<<endl;	//1 : 1, 0 : 2, 3 : 2
+	}
+*/
+
+#endif
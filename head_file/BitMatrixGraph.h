@@ -0,0 +1,66 @@
+#ifndef __BITMATRIXGRAPH_H__
+#define __BITMATRIXGRAPH_H__
+
+#include "DynamicMatrixGraph.h"
+
+/*
+位图邻接矩阵（BitMatrixGraph）
+MatrixGraph残留问题：
+	E* m_edges[N][N]，每条边单独申请一个E，SetEdge每次新建边都要调用new
+	每个格子都是一个指针，N = 4096时仅指针就占用128MB，并且整个矩阵在对象内部，对象放在栈上时会栈溢出
+	OD、ID、GetAdjacent都要逐个检查N个指针
+
+BitMatrixGraph将边的存在与否和权值分开存放，全部在堆上：
+	m_weight[N * N]		权值直接存放在一维数组中，不存在的边的值没有意义
+	m_bits[N][W]		邻接位图，第i行的第j位表示<i, j>是否存在，每64个顶点一个字
+	m_tbits[N][W]		转置的位图，第j行的第i位表示<i, j>是否存在，用于ID
+
+	SetEdge、RemoveEdge		O(1)，只修改权值和两个位，不申请内存
+	OD(i)、ID(i)			一行位图的popcount，O(N / 64)
+	GetAdjacent、游标		按字扫描一行位图，用ctz（末尾0的个数）直接跳到下一个1，空的64个顶点只需要一次比较
+
+	N = 4096、E = int时，权值64MB，两个位图各2MB
+	要求E有默认构造函数，构造时会构造N * N个E
+
+实现与DynamicMatrixGraph相同，只是顶点数固定为N：
+	AddVertex、RemoveVertex不对外公开，通过DynamicMatrixGraph的引用调用时抛出InvalidOperationException
+
+注：图的节点可以为空，为空的节点也可以连接node（与MatrixGraph相同）
+*/
+
+namespace YzcLib{
+
+template<int N, typename V, typename E>
+class BitMatrixGraph: public DynamicMatrixGraph<V, E>{
+protected:
+	using DynamicMatrixGraph<V, E>::AddVertex;
+	using DynamicMatrixGraph<V, E>::RemoveVertex;
+public:
+	BitMatrixGraph();
+};
+
+template<int N, typename V, typename E>
+BitMatrixGraph<N, V, E>::BitMatrixGraph(): DynamicMatrixGraph<V, E>(N){
+	this->m_fixed = true;
+}
+
+/*
+Test code
+	BitMatrixGraph<4096, int, int>* g = new BitMatrixGraph<4096, int, int>();
+	g->SetEdge(0, 1, 1);
+	g->SetEdge(1, 0, 2);
+	g->SetEdge(1, 2, 3);
+	g->SetEdge(1, 4000, 4);
+
+	cout<<g->OD(1)<<" "<<g->ID(0)<<endl;	//3 1
+
+	AdjacentCursor<int> c;
+	for(bool ok = g->FirstAdjacent(1, c); ok; ok = g->NextAdjacent(c)){
+		cout<<c.to<<" "<<*c.weight<<endl;	//0 2, 2 3, 4000 4
+	}
+	delete g;
+*/
+
+}
+
+#endif
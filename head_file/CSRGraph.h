@@ -0,0 +1,711 @@
+#ifndef __CSRGRAPH_H__
+#define __CSRGRAPH_H__
+
+#include "Graph.h"
+#include "Exception.h"
+#include "DynamicArray.h"
+
+/*
+压缩稀疏行（Compressed Sparse Row，CSR）
+邻接链表法残留问题：
+	顶点存储在LinkList<Vertex*>中，GetVertex(i)、IsAdjacent、GetEdge都要沿着链表走O(n)步
+	每个顶点的边也是一个链表，遍历邻接顶点时每一步都是一次指针跳转，缓存命中率很低
+	Graph.h中的BFS、DFS、Dijkstra对每个顶点都要调用GetAdjacent、GetEdge，代价被放大
+
+CSR将所有的边按起点排序后连续存放：
+	m_offset[n + 1]		顶点i的边存放在[m_offset[i], m_offset[i + 1])中
+	m_adj[e]			边的终点，同一个起点的边按终点从小到大排列
+	m_weight[e]			边的权值，与m_adj一一对应
+
+	0 -> 1(5), 3(6)
+	1 -> 2(8)
+	2 -> 3(2)
+	3 -> 1(9)
+
+	m_offset = 0 2 3 4 5
+	m_adj    = 1 3 2 3 1
+	m_weight = 5 6 8 2 9
+
+	GetVertex、OD、ID		O(1)
+	IsAdjacent、GetEdge		O(log(d))，在一行中二分查找
+	GetAdjacent				O(d)，一次连续的拷贝
+	FirstAdjacent、NextAdjacent	O(1)，游标就是边在数组中的下标
+	SetEdge（已有的边）		O(log(d))，只修改权值
+	SetEdge（新边）、RemoveEdge	O(e)，需要移动之后所有的边（CSR适合先建好、再反复查询的图）
+
+批量构造：
+	CSRGraph(n, edges)	两遍计数排序（先按终点，再按起点，计数排序是稳定的），O(n + e)，不需要比较
+						同一条边出现多次时，与逐条SetEdge相同，后出现的权值有效
+	CSRGraph(g)			将任意一个Graph（MatrixGraph、ListGraph）转换为CSR，顶点的值一并拷贝
+
+顺序访问：
+	Begin(i)、End(i)为顶点i的边在数组中的范围，Target(k)、Weight(k)为第k条边的终点和权值
+	不申请任何空间，适合需要直接遍历边的算法
+
+BFSLevel(i)：
+	方向优化（自顶向下/自底向上）、位图frontier、按层并行的广度优先遍历，返回每个顶点的层数
+*/
+
+namespace YzcLib{
+
+template<typename V, typename E>
+class CSRGraph: public Graph<V, E>{
+protected:
+	int m_vcount;
+	DynamicArray<int> m_offset;
+	DynamicArray<int> m_adj;
+	DynamicArray<E> m_weight;
+	DynamicArray<int> m_indegree;
+
+	DynamicArray<V> m_vertexes;
+	DynamicArray<bool> m_assigned;		//顶点是否已经赋值
+
+	//反向的CSR（入边），BFSLevel使用
+	DynamicArray<int> m_roffset;
+	DynamicArray<int> m_radj;
+	bool m_rvalid;
+
+	//BFSLevel切换方向的参数
+	enum{ ALPHA = 14, BETA = 24 };
+
+	#define CHECKBOUND(i) ((i >= 0) && (i < VCount()))
+
+	void _init(int n);
+	void _build(const Array<Edge<E>>& edges, int count);
+	//边<i, j>在数组中的位置，不存在返回-1
+	int _locate(int i, int j) const;
+	void _build_reverse();
+public:
+	CSRGraph(int n = 0);
+	//n个顶点，边为edges[0, edges.Length())
+	CSRGraph(int n, const Array<Edge<E>>& edges);
+	CSRGraph(Graph<V, E>& g);
+
+	V GetVertex(int i);
+	bool GetVertex(int i, V& value);
+	bool SetVertex(int i, const V& value);
+
+	SharedPointer<Array<int>> GetAdjacent(int i);
+	bool FirstAdjacent(int i, AdjacentCursor<E>& c);
+	bool NextAdjacent(AdjacentCursor<E>& c);
+	bool IsAdjacent(int i, int j);
+
+	E GetEdge(int i, int j);
+	bool GetEdge(int i, int j, E& value);
+	bool SetEdge(int i, int j, const E& value);
+	bool RemoveEdge(int i, int j);
+
+	int VCount();
+	int ECount();
+	int OD(int i);
+	int ID(int i);
+
+	int Begin(int i) const;
+	int End(int i) const;
+	int Target(int k) const;
+	const E& Weight(int k) const;
+
+	//方向优化的并行BFS，返回每个顶点的层数，不可达为-1
+	SharedPointer<Array<int>> BFSLevel(int i);
+};
+
+template<typename V, typename E>
+void CSRGraph<V, E>::_init(int n){
+	if(n < 0){
+		THROW_EXCEPTION(InvalidParameterException, "Vertex count can not be negative...");
+	}
+
+	m_vcount = n;
+	m_rvalid = false;
+	m_offset.resize(n + 1);
+	m_indegree.resize(n);
+	m_vertexes.resize(n);
+	m_assigned.resize(n);
+
+	int* offset = m_offset.GetArray();
+	for(int i = 0; i < n; i++){
+		offset[i] = 0;
+		m_indegree.GetArray()[i] = 0;
+		m_assigned.GetArray()[i] = false;
+	}
+	offset[n] = 0;
+}
+
+/*
+两遍计数排序
+	1.按终点分桶，得到按终点排列的顺序
+	2.按上一步的顺序，再按起点分桶，计数排序是稳定的，同一个起点的边按终点从小到大排列
+	相同的<i, j>相邻，并且保持输入的顺序，只保留最后一条
+*/
+template<typename V, typename E>
+void CSRGraph<V, E>::_build(const Array<Edge<E>>& edges, int count){
+	int n = m_vcount;
+	for(int k = 0; k < count; k++){
+		const Edge<E>& edge = edges.GetArray()[k];
+		if(!((edge.b >= 0) && (edge.b < n) && (edge.e >= 0) && (edge.e < n))){
+			THROW_EXCEPTION(InvalidParameterException, "Edge<i,j> is invalid...");
+		}
+	}
+
+	DynamicArray<int> bucket(n + 1);
+	DynamicArray<int> byend(count);
+	DynamicArray<int> order(count);
+	int* b = bucket.GetArray();
+
+	for(int i = 0; i <= n; i++) b[i] = 0;
+	for(int k = 0; k < count; k++) b[edges.GetArray()[k].e + 1]++;
+	for(int i = 0; i < n; i++) b[i + 1] += b[i];
+	for(int k = 0; k < count; k++){
+		byend.GetArray()[b[edges.GetArray()[k].e]++] = k;
+	}
+
+	for(int i = 0; i <= n; i++) b[i] = 0;
+	for(int k = 0; k < count; k++) b[edges.GetArray()[k].b + 1]++;
+	for(int i = 0; i < n; i++) b[i + 1] += b[i];
+	for(int k = 0; k < count; k++){
+		int t = byend.GetArray()[k];
+		order.GetArray()[b[edges.GetArray()[t].b]++] = t;
+	}
+
+	//去掉重复的边，同时统计每个起点的出度和每个终点的入度
+	m_adj.resize(count);
+	m_weight.resize(count);
+	int* offset = m_offset.GetArray();
+	int* adj = m_adj.GetArray();
+	E* weight = m_weight.GetArray();
+	int* indegree = m_indegree.GetArray();
+	int e = 0;
+
+	for(int i = 0; i <= n; i++) offset[i] = 0;
+	for(int i = 0; i < n; i++) indegree[i] = 0;
+
+	for(int k = 0; k < count; k++){
+		const Edge<E>& edge = edges.GetArray()[order.GetArray()[k]];
+		if((k > 0) && (e > 0) && (adj[e - 1] == edge.e) && (edges.GetArray()[order.GetArray()[k - 1]].b == edge.b)){
+			weight[e - 1] = edge.data;
+		}
+		else{
+			adj[e] = edge.e;
+			weight[e] = edge.data;
+			e++;
+			offset[edge.b + 1]++;
+			indegree[edge.e]++;
+		}
+	}
+	for(int i = 0; i < n; i++){
+		offset[i + 1] += offset[i];
+	}
+
+	if(e < count){
+		m_adj.resize(e);
+		m_weight.resize(e);
+	}
+}
+
+template<typename V, typename E>
+int CSRGraph<V, E>::_locate(int i, int j) const{
+	const int* adj = m_adj.GetArray();
+	int l = m_offset.GetArray()[i];
+	int r = m_offset.GetArray()[i + 1];
+
+	while(l < r){
+		int mid = l + (r - l) / 2;
+		if(adj[mid] < j){
+			l = mid + 1;
+		}
+		else{
+			r = mid;
+		}
+	}
+	return ((l < m_offset.GetArray()[i + 1]) && (adj[l] == j)) ? l : -1;
+}
+
+template<typename V, typename E>
+CSRGraph<V, E>::CSRGraph(int n){
+	_init(n);
+}
+
+template<typename V, typename E>
+CSRGraph<V, E>::CSRGraph(int n, const Array<Edge<E>>& edges){
+	_init(n);
+	_build(edges, edges.Length());
+}
+
+/*
+通过Graph的接口逐个读出顶点和边，再批量构造
+	没有赋值的顶点GetVertex会抛出异常，转换之后依旧没有赋值
+*/
+template<typename V, typename E>
+CSRGraph<V, E>::CSRGraph(Graph<V, E>& g){
+	int n = g.VCount();
+	_init(n);
+
+	for(int i = 0; i < n; i++){
+		try{
+			V value;
+			if(g.GetVertex(i, value)){
+				SetVertex(i, value);
+			}
+		}
+		catch(const Exception& e){
+		}
+	}
+
+	DynamicArray<Edge<E>> edges(g.ECount());
+	unsigned int count = 0;
+	AdjacentCursor<E> c;
+	for(int i = 0; i < n; i++){
+		for(bool ok = g.FirstAdjacent(i, c); ok; ok = g.NextAdjacent(c)){
+			if(count == edges.Length()){
+				edges.resize(count ? count * 2 : 16);
+			}
+			edges[count++] = Edge<E>(i, c.to, *c.weight);
+		}
+	}
+	_build(edges, count);
+}
+
+template<typename V, typename E>
+V CSRGraph<V, E>::GetVertex(int i){
+	V rst;
+	if(!GetVertex(i, rst)){
+		THROW_EXCEPTION(InvalidParameterException, "Parameter i is invalid...");
+	}
+	return rst;
+}
+
+template<typename V, typename E>
+bool CSRGraph<V, E>::GetVertex(int i, V& value){
+	bool rst = CHECKBOUND(i);
+	if(rst){
+		if(m_assigned[i]){
+			value = m_vertexes[i];
+		}
+		else{
+			THROW_EXCEPTION(InvalidOperationException, "No value assigned to this vertex...");
+		}
+	}
+	return rst;
+}
+
+template<typename V, typename E>
+bool CSRGraph<V, E>::SetVertex(int i, const V& value){
+	bool rst = CHECKBOUND(i);
+	if(rst){
+		m_vertexes[i] = value;
+		m_assigned[i] = true;
+	}
+	return rst;
+}
+
+template<typename V, typename E>
+SharedPointer<Array<int>> CSRGraph<V, E>::GetAdjacent(int i){
+	DynamicArray<int>* rst = NULL;
+	if(CHECKBOUND(i)){
+		int begin = m_offset[i];
+		int len = m_offset[i + 1] - begin;
+		rst = new DynamicArray<int>(len);
+		if(rst != NULL){
+			const int* adj = m_adj.GetArray() + begin;
+			int* a = rst->GetArray();
+			for(int k = 0; k < len; k++){
+				a[k] = adj[k];
+			}
+		}
+		else{
+			THROW_EXCEPTION(NotEnoughMemoryException, "No memory to create ret object...");
+		}
+	}
+	else{
+		THROW_EXCEPTION(InvalidParameterException, "Index i is invalid...");
+	}
+	return rst;
+}
+
+//游标为边在数组中的下标，第i行结束于m_offset[i + 1]
+template<typename V, typename E>
+bool CSRGraph<V, E>::FirstAdjacent(int i, AdjacentCursor<E>& c){
+	if(!CHECKBOUND(i)){
+		THROW_EXCEPTION(InvalidParameterException, "Index i is invalid...");
+	}
+	c.from = i;
+	c.pos = m_offset.GetArray()[i] - 1;
+	return NextAdjacent(c);
+}
+
+template<typename V, typename E>
+bool CSRGraph<V, E>::NextAdjacent(AdjacentCursor<E>& c){
+	int k = c.pos + 1;
+	bool rst = (k < m_offset.GetArray()[c.from + 1]);
+
+	c.pos = k;
+	c.to = rst ? m_adj.GetArray()[k] : -1;
+	c.weight = rst ? m_weight.GetArray() + k : NULL;
+	return rst;
+}
+
+template<typename V, typename E>
+bool CSRGraph<V, E>::IsAdjacent(int i, int j){
+	return CHECKBOUND(i) && CHECKBOUND(j) && (_locate(i, j) >= 0);
+}
+
+template<typename V, typename E>
+E CSRGraph<V, E>::GetEdge(int i, int j){
+	E rst;
+	if(!GetEdge(i, j, rst)){
+		THROW_EXCEPTION(InvalidParameterException, "Edge<i,j> is invalid...");
+	}
+	return rst;
+}
+
+template<typename V, typename E>
+bool CSRGraph<V, E>::GetEdge(int i, int j, E& value){
+	bool rst = CHECKBOUND(i) && CHECKBOUND(j);
+	if(rst){
+		int k = _locate(i, j);
+		if(k >= 0){
+			value = m_weight.GetArray()[k];
+		}
+		else{
+			THROW_EXCEPTION(InvalidOperationException, "No value assigned to this edge...");
+		}
+	}
+	return rst;
+}
+
+/*
+已有的边只修改权值
+新边插入到第i行中按终点排序的位置，之后的边整体后移一位，之后各行的偏移加1
+*/
+template<typename V, typename E>
+bool CSRGraph<V, E>::SetEdge(int i, int j, const E& value){
+	bool rst = CHECKBOUND(i) && CHECKBOUND(j);
+	if(rst){
+		int k = _locate(i, j);
+		if(k >= 0){
+			m_weight.GetArray()[k] = value;
+		}
+		else{
+			int e = ECount();
+			const int* row = m_adj.GetArray();
+			int pos = m_offset[i];
+			while((pos < m_offset[i + 1]) && (row[pos] < j)) pos++;
+
+			m_adj.resize(e + 1);
+			m_weight.resize(e + 1);
+			int* adj = m_adj.GetArray();
+			E* weight = m_weight.GetArray();
+			for(int t = e; t > pos; t--){
+				adj[t] = adj[t - 1];
+				weight[t] = weight[t - 1];
+			}
+			adj[pos] = j;
+			weight[pos] = value;
+
+			int* offset = m_offset.GetArray();
+			for(int t = i + 1; t <= m_vcount; t++){
+				offset[t]++;
+			}
+			m_indegree[j]++;
+			m_rvalid = false;
+		}
+		this->_invalidate();
+	}
+	return rst;
+}
+
+template<typename V, typename E>
+bool CSRGraph<V, E>::RemoveEdge(int i, int j){
+	bool rst = CHECKBOUND(i) && CHECKBOUND(j);
+	if(rst){
+		int k = _locate(i, j);
+		//若不存在，直接返回，不做任何操作
+		if(k >= 0){
+			int e = ECount();
+			int* adj = m_adj.GetArray();
+			E* weight = m_weight.GetArray();
+			for(int t = k; t < e - 1; t++){
+				adj[t] = adj[t + 1];
+				weight[t] = weight[t + 1];
+			}
+			m_adj.resize(e - 1);
+			m_weight.resize(e - 1);
+
+			int* offset = m_offset.GetArray();
+			for(int t = i + 1; t <= m_vcount; t++){
+				offset[t]--;
+			}
+			m_indegree[j]--;
+			m_rvalid = false;
+			this->_invalidate();
+		}
+	}
+	return rst;
+}
+
+template<typename V, typename E>
+int CSRGraph<V, E>::VCount(){
+	return m_vcount;
+}
+
+template<typename V, typename E>
+int CSRGraph<V, E>::ECount(){
+	return m_offset.GetArray()[m_vcount];
+}
+
+template<typename V, typename E>
+int CSRGraph<V, E>::OD(int i){
+	int rst = 0;
+	if(CHECKBOUND(i)){
+		rst = m_offset[i + 1] - m_offset[i];
+	}
+	else{
+		THROW_EXCEPTION(InvalidParameterException, "Index i is invalid...");
+	}
+	return rst;
+}
+
+template<typename V, typename E>
+int CSRGraph<V, E>::ID(int i){
+	int rst = 0;
+	if(CHECKBOUND(i)){
+		rst = m_indegree[i];
+	}
+	else{
+		THROW_EXCEPTION(InvalidParameterException, "Index i is invalid...");
+	}
+	return rst;
+}
+
+template<typename V, typename E>
+int CSRGraph<V, E>::Begin(int i) const{
+	return m_offset.GetArray()[i];
+}
+
+template<typename V, typename E>
+int CSRGraph<V, E>::End(int i) const{
+	return m_offset.GetArray()[i + 1];
+}
+
+template<typename V, typename E>
+int CSRGraph<V, E>::Target(int k) const{
+	return m_adj.GetArray()[k];
+}
+
+template<typename V, typename E>
+const E& CSRGraph<V, E>::Weight(int k) const{
+	return m_weight.GetArray()[k];
+}
+
+/*
+反向的CSR（每个顶点的入边），自底向上的BFS需要，第一次使用时通过计数排序建立，O(n + e)
+边发生变化之后失效，下一次使用时重新建立
+*/
+template<typename V, typename E>
+void CSRGraph<V, E>::_build_reverse(){
+	if(!m_rvalid){
+		int n = m_vcount;
+		int e = ECount();
+		m_roffset.resize(n + 1);
+		m_radj.resize(e);
+
+		const int* offset = m_offset.GetArray();
+		const int* adj = m_adj.GetArray();
+		int* roffset = m_roffset.GetArray();
+		int* radj = m_radj.GetArray();
+
+		//入度即为每个顶点在反向CSR中的边数
+		roffset[0] = 0;
+		for(int i = 0; i < n; i++){
+			roffset[i + 1] = roffset[i] + m_indegree.GetArray()[i];
+		}
+
+		DynamicArray<int> pos(n);
+		int* p = pos.GetArray();
+		for(int i = 0; i < n; i++){
+			p[i] = roffset[i];
+		}
+		for(int i = 0; i < n; i++){
+			for(int k = offset[i]; k < offset[i + 1]; k++){
+				radj[p[adj[k]]++] = i;
+			}
+		}
+		m_rvalid = true;
+	}
+}
+
+/*
+方向优化的BFS（direction-optimizing BFS）
+	按层进行（level-synchronous），第d层的顶点（frontier）全部处理完之后才处理第d + 1层
+	每一层可以选择两个方向之一：
+		自顶向下（top-down）	遍历frontier中每个顶点的出边，终点没有访问过时加入下一层
+								frontier小时代价小，检查的边数为frontier的出度之和
+		自底向上（bottom-up）	遍历每个还没有访问过的顶点的入边，只要有一个起点在frontier中就加入下一层并立即停止
+								frontier很大时，大部分顶点第一条入边就能找到父结点，检查的边数远少于自顶向下
+
+	切换的条件（Beamer的启发式）：
+		mf（frontier的出边数） > mu（未访问顶点的出边数） / ALPHA时切换为自底向上
+		nf（frontier的顶点数） < n / BETA时切换回自顶向下
+
+	frontier的表示：
+		自顶向下使用顶点数组，自底向上使用位图（每个顶点一位），切换方向时相互转换
+		位图中64个顶点为一个字，自底向上每次处理一个字，每个字只由一个线程写，不需要原子操作
+
+	并行：
+		每一层内部使用OpenMP并行（编译时没有-fopenmp时不定义_OPENMP，单线程执行）
+		自顶向下时多个线程可能同时发现同一个顶点，使用CAS（__atomic_compare_exchange_n）保证只加入一次
+
+返回值为每个顶点的层数（起点为0），不可达的顶点为-1
+同一层中顶点的顺序不确定，按层数排序就是一个合法的广度优先遍历顺序
+*/
+template<typename V, typename E>
+SharedPointer<Array<int>> CSRGraph<V, E>::BFSLevel(int i){
+	if(!CHECKBOUND(i)){
+		THROW_EXCEPTION(InvalidParameterException, "index i is invalid...");
+	}
+	_build_reverse();
+
+	const int n = m_vcount;
+	const int words = (n + 63) / 64;
+	const int* offset = m_offset.GetArray();
+	const int* adj = m_adj.GetArray();
+	const int* roffset = m_roffset.GetArray();
+	const int* radj = m_radj.GetArray();
+
+	DynamicArray<int>* rst = new DynamicArray<int>(n);
+	if(rst == NULL){
+		THROW_EXCEPTION(NotEnoughMemoryException, "no memory to create ret obj...");
+	}
+	int* level = rst->GetArray();
+	for(int v = 0; v < n; v++){
+		level[v] = -1;
+	}
+
+	DynamicArray<int> queue(n);
+	DynamicArray<int> next(n);
+	DynamicArray<unsigned long long> front(words);
+	DynamicArray<unsigned long long> nfront(words);
+	int* q = queue.GetArray();
+	int* nq = next.GetArray();
+	unsigned long long* bits = front.GetArray();
+	unsigned long long* nbits = nfront.GetArray();
+
+	level[i] = 0;
+	q[0] = i;
+	int qsize = 1;
+	bool bottomup = false;
+	long long mf = offset[i + 1] - offset[i];
+	long long mu = ECount() - mf;
+
+	for(int d = 0; qsize > 0; d++){
+		//选择方向，需要时转换frontier的表示
+		if(!bottomup && (mf > mu / ALPHA)){
+			bottomup = true;
+			for(int w = 0; w < words; w++){
+				bits[w] = 0;
+			}
+			for(int k = 0; k < qsize; k++){
+				bits[q[k] >> 6] |= 1ULL << (q[k] & 63);
+			}
+		}
+		else if(bottomup && (qsize < n / BETA)){
+			bottomup = false;
+			int count = 0;
+			for(int v = 0; v < n; v++){
+				if(level[v] == d){
+					q[count++] = v;
+				}
+			}
+		}
+
+		int nsize = 0;
+		long long scout = 0;
+		if(bottomup){
+			#ifdef _OPENMP
+			#pragma omp parallel for schedule(dynamic, 16) reduction(+: nsize, scout)
+			#endif
+			for(int w = 0; w < words; w++){
+				unsigned long long found = 0;
+				int end = (w * 64 + 64 < n) ? w * 64 + 64 : n;
+				for(int v = w * 64; v < end; v++){
+					if(level[v] < 0){
+						for(int k = roffset[v]; k < roffset[v + 1]; k++){
+							int u = radj[k];
+							if(bits[u >> 6] & (1ULL << (u & 63))){
+								level[v] = d + 1;
+								found |= 1ULL << (v & 63);
+								nsize++;
+								scout += offset[v + 1] - offset[v];
+								break;
+							}
+						}
+					}
+				}
+				nbits[w] = found;
+			}
+
+			unsigned long long* t = bits;
+			bits = nbits;
+			nbits = t;
+		}
+		else{
+			#ifdef _OPENMP
+			#pragma omp parallel for schedule(dynamic, 64) reduction(+: scout)
+			#endif
+			for(int k = 0; k < qsize; k++){
+				int u = q[k];
+				for(int t = offset[u]; t < offset[u + 1]; t++){
+					int v = adj[t];
+					int expected = -1;
+					if((__atomic_load_n(&level[v], __ATOMIC_RELAXED) < 0) &&
+						__atomic_compare_exchange_n(&level[v], &expected, d + 1, false, __ATOMIC_RELAXED, __ATOMIC_RELAXED)){
+						nq[__atomic_fetch_add(&nsize, 1, __ATOMIC_RELAXED)] = v;
+						scout += offset[v + 1] - offset[v];
+					}
+				}
+			}
+
+			int* t = q;
+			q = nq;
+			nq = t;
+		}
+
+		qsize = nsize;
+		mf = scout;
+		mu -= scout;
+	}
+
+	return rst;
+}
+
+/*
+Test code
+	ListGraph<char, int> lg;
+	for(int i = 0; i < 4; i++){
+		lg.AddVertex('A' + i);
+	}
+	lg.SetEdge(0, 1, 5);
+	lg.SetEdge(0, 3, 6);
+	lg.SetEdge(1, 2, 8);
+	lg.SetEdge(2, 3, 2);
+	lg.SetEdge(3, 1, 9);
+
+	CSRGraph<char, int> g(lg);
+	cout<<g.GetVertex(2)<<" "<<g.GetEdge(3, 1)<<endl;	//C 9
+	cout<<g.ID(1)<<" "<<g.OD(0)<<endl;					//2 2
+
+	for(int k = g.Begin(0); k < g.End(0); k++){
+		cout<<g.Target(k)<<" "<<g.Weight(k)<<endl;		//1 5, 3 6
+	}
+
+	DynamicArray<Edge<int>> edges(3);
+	edges[0] = Edge<int>(0, 2, 1);
+	edges[1] = Edge<int>(2, 1, 4);
+	edges[2] = Edge<int>(0, 1, 7);
+	CSRGraph<int, int> h(3, edges);
+	SharedPointer<Array<int>> bfs = h.BFS(0);			//0 1 2
+*/
+
+}
+
+#endif
@@ -26,8 +26,23 @@ using namespace std;
 #include "LinkQueue.h"
 #include "StackQueue.h"
 #include "QueueStack.h"
+#include "PriorityQueue.h"
+#include "IndexedHeap.h"
+#include "PairingHeap.h"
 #include "String.h"
+#include "StringView.h"
+#include "StringSearch.h"
+#include "Pattern.h"
+#include "AhoCorasick.h"
+#include "StringTokenizer.h"
+#include "Hash.h"
+#include "StringPool.h"
+#include "StringBuilder.h"
+#include "Rope.h"
+#include "SuffixArray.h"
 #include "Sort.h"
+#include "LoserTree.h"
+#include "DisjointSet.h"
 // #include "Tree.h"
 #include "TreeNode.h"
 #include "GTree.h"
@@ -36,6 +51,9 @@ using namespace std;
 #include "BTreeNode.h"
 // #include "Graph.h"
 #include "MatrixGraph.h"
+#include "DynamicMatrixGraph.h"
+#include "BitMatrixGraph.h"
 #include "ListGraph.h"
+#include "CSRGraph.h"
 
 #endif
\ No newline at end of file
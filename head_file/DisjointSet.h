@@ -0,0 +1,95 @@
+#ifndef __DISJOINTSET_H__
+#define __DISJOINTSET_H__
+
+#include "Object.h"
+#include "DynamicArray.h"
+
+/*
+并查集（DisjointSet，Union-Find）
+	维护n个元素（0 ~ n-1）划分成的若干个不相交的集合：
+		Find(x)			x所在集合的代表元素（根）
+		Union(a, b)		合并a、b所在的集合，已经在同一个集合时返回false
+		Connected(a, b)	a、b是否在同一个集合
+
+	每个集合是一棵树，m_parent[x]为x的父结点，根的父结点是自己
+	Kruskal原来的前驱数组每次都沿着前驱走到尽头，没有任何优化，最坏情况下一次查找为O(n)
+
+	路径减半（path halving）：
+		查找时令x的父结点指向祖父结点，x再跳到祖父结点，一次遍历完成，不需要递归或者第二次遍历
+	按大小合并（union by size）：
+		小的树挂到大的树下面，树的高度不超过log(n)
+	两者一起使用，均摊复杂度为O(α(n))（反阿克曼函数，实际中不超过4）
+*/
+
+namespace YzcLib{
+
+class DisjointSet: public Object{
+protected:
+	DynamicArray<int> m_parent;
+	DynamicArray<int> m_size;		//根所在集合的大小，只对根有意义
+	int m_count;					//集合的个数
+
+	void _check(int x) const;
+public:
+	DisjointSet(int n = 0);
+
+	//重新初始化为n个单元素集合
+	void Reset(int n);
+
+	int Find(int x);
+	bool Union(int a, int b);
+	bool Connected(int a, int b);
+	//x所在集合的大小
+	int Size(int x);
+
+	int Count() const;
+	int Length() const;
+};
+
+/*
+并发的并查集（ConcurrentDisjointSet）
+	多个线程可以同时调用Find、Union、Connected（例如用OpenMP并行处理边的数组）
+	m_parent的读写都使用原子操作（GCC的__atomic内建函数）：
+		Find		路径减半，修改父结点使用CAS，失败说明其他线程已经修改过，直接继续
+		Union		总是把编号大的根挂到编号小的根下面（CAS要求它仍然是根），失败时重新查找再重试
+	按编号合并保证不会形成环，但不能保证树的高度，依靠路径减半压缩
+
+	Reset不是线程安全的，需要在并行区域之外调用
+	ConcurrentDisjointSet禁止拷贝
+*/
+class ConcurrentDisjointSet: public Object{
+protected:
+	DynamicArray<int> m_parent;
+	int m_count;
+
+	void _check(int x) const;
+
+	ConcurrentDisjointSet(const ConcurrentDisjointSet&);
+	ConcurrentDisjointSet& operator = (const ConcurrentDisjointSet&);
+public:
+	ConcurrentDisjointSet(int n = 0);
+
+	void Reset(int n);
+
+	int Find(int x);
+	bool Union(int a, int b);
+	bool Connected(int a, int b);
+
+	int Count() const;
+	int Length() const;
+};
+
+}
+
+/*
+Test code
+	DisjointSet ds(5);
+	ds.Union(0, 1);
+	ds.Union(3, 4);
+	cout<<ds.Connected(0, 1)<<endl;		//1
+	cout<<ds.Connected(1, 3)<<endl;		//0
+	cout<<ds.Size(4)<<endl;				//2
+	cout<<ds.Count()<<endl;				//3
+*/
+
+#endif
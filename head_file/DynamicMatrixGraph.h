@@ -0,0 +1,531 @@
+#ifndef __DYNAMICMATRIXGRAPH_H__
+#define __DYNAMICMATRIXGRAPH_H__
+
+#include "Graph.h"
+#include "Exception.h"
+#include "DynamicArray.h"
+#include <new>
+
+/*
+动态邻接矩阵（DynamicMatrixGraph）
+MatrixGraph、BitMatrixGraph残留问题：
+	顶点数N是模板参数，编译时确定，不能根据输入的数据决定图的大小
+	MatrixGraph的N * N指针矩阵在对象内部，N较大时放在栈上会栈溢出
+
+DynamicMatrixGraph的顶点数在构造时确定，所有数据在堆上，存储方式与BitMatrixGraph相同：
+	m_weight	权值，(i, j)在 i * m_wstride + j
+	m_bits		邻接位图，第i行从 i * m_bstride 开始，第j位表示<i, j>是否存在
+	m_tbits		转置的位图，用于ID
+
+行对齐：
+	每一行的起始地址按64字节（一个缓存行）对齐：
+		行的长度（stride）向上取整为64字节的整数倍，数组的起始位置跳到第一个对齐的元素（_align）
+	扫描一行时不会跨越多余的缓存行，编译器可以使用对齐的SIMD指令
+	sizeof(E)不能整除64时无法对齐，只保证位图的行对齐
+
+增长：
+	容量（m_capacity）不够时AddVertex将容量翻倍，重新申请并拷贝已有的行，均摊O(n)
+	RemoveVertex删除最后一个顶点以及与它相关的边，容量不变
+
+Row(i)、Bits(i)返回一行的起始地址，可以直接扫描（Bits(i)中超过VCount()的位都是0）
+DynamicMatrixGraph禁止拷贝：m_weight等指向自己申请的缓冲区中对齐的位置，拷贝需要重新申请并对齐（见_reserve）
+*/
+
+namespace YzcLib{
+
+template<typename V, typename E>
+class DynamicMatrixGraph: public Graph<V, E>{
+protected:
+	enum{ ALIGN = 64 };
+
+	V* m_vertexes;
+	bool* m_assigned;				//顶点是否已经赋值
+	E* m_wbuf;						//权值的存储空间，m_weight为其中第一个对齐的位置
+	unsigned long long* m_bbuf;
+	unsigned long long* m_tbuf;
+	E* m_weight;
+	unsigned long long* m_bits;
+	unsigned long long* m_tbits;
+	size_t m_wstride;
+	size_t m_bstride;
+	int m_vcount;
+	int m_capacity;
+	int m_ecount;
+	bool m_fixed;					//顶点数固定（BitMatrixGraph），不能增加或删除顶点
+
+	#define CHECKBOUND(i) ((i >= 0) && (i < VCount()))
+
+	//buf中第一个按ALIGN对齐的元素，T的大小不能整除ALIGN时返回起始位置
+	template<typename T>
+	static T* _align(T* buf);
+	//申请 rows * stride + extra 个T，失败或者大小超出size_t时抛出异常
+	template<typename T>
+	static T* _alloc(size_t rows, size_t stride, size_t extra);
+	//将容量扩大为capacity，保留已有的顶点和边
+	void _reserve(int capacity);
+	void _free();
+	bool _test(int i, int j) const;
+	int _count(const unsigned long long* row) const;
+
+	DynamicMatrixGraph(const DynamicMatrixGraph&);
+	DynamicMatrixGraph& operator = (const DynamicMatrixGraph&);
+public:
+	DynamicMatrixGraph(int n = 0);
+
+	V GetVertex(int i);
+	bool GetVertex(int i, V& value);
+	bool SetVertex(int i, const V& value);
+
+	SharedPointer<Array<int>> GetAdjacent(int i);
+	bool FirstAdjacent(int i, AdjacentCursor<E>& c);
+	bool NextAdjacent(AdjacentCursor<E>& c);
+
+	E GetEdge(int i, int j);
+	bool GetEdge(int i, int j, E& value);
+	bool SetEdge(int i, int j, const E& value);
+	bool RemoveEdge(int i, int j);
+	bool IsAdjacent(int i, int j);
+
+	int VCount();
+	int ECount();
+	int OD(int i);
+	int ID(int i);
+
+	//增加一个顶点，返回顶点编号
+	int AddVertex();
+	int AddVertex(const V& value);
+	//删除最后一个顶点
+	void RemoveVertex();
+	int Capacity() const;
+
+	const E* Row(int i) const;
+	const unsigned long long* Bits(int i) const;
+
+	~DynamicMatrixGraph();
+};
+
+template<typename V, typename E>
+DynamicMatrixGraph<V, E>::DynamicMatrixGraph(int n){
+	if(n < 0){
+		THROW_EXCEPTION(InvalidParameterException, "Vertex count can not be negative...");
+	}
+	m_vertexes = NULL;
+	m_assigned = NULL;
+	m_wbuf = NULL;
+	m_bbuf = NULL;
+	m_tbuf = NULL;
+	m_weight = NULL;
+	m_bits = NULL;
+	m_tbits = NULL;
+	m_wstride = 0;
+	m_bstride = 0;
+	m_vcount = 0;
+	m_capacity = 0;
+	m_ecount = 0;
+	m_fixed = false;
+
+	_reserve(n);
+	m_vcount = n;
+}
+
+template<typename V, typename E>
+template<typename T>
+T* DynamicMatrixGraph<V, E>::_align(T* buf){
+	T* rst = buf;
+	if(ALIGN % sizeof(T) == 0){
+		while(reinterpret_cast<unsigned long long>(rst) % ALIGN != 0){
+			rst++;
+		}
+	}
+	return rst;
+}
+
+template<typename V, typename E>
+template<typename T>
+T* DynamicMatrixGraph<V, E>::_alloc(size_t rows, size_t stride, size_t extra){
+	//先检查乘法是否溢出，溢出时不能回绕成一个很小的数组
+	size_t limit = static_cast<size_t>(-1) / sizeof(T);
+	if((stride != 0) && ((rows > (limit - extra) / stride))){
+		THROW_EXCEPTION(NotEnoughMemoryException, "DynamicMatrixGraph is too large...");
+	}
+	//T不是Object时new失败抛出bad_alloc，统一为NotEnoughMemoryException
+	T* rst = NULL;
+	try{
+		rst = new T[rows * stride + extra];
+	}
+	catch(const std::bad_alloc&){
+		rst = NULL;
+	}
+	if(rst == NULL){
+		THROW_EXCEPTION(NotEnoughMemoryException, "No memory to create DynamicMatrixGraph object...");
+	}
+	return rst;
+}
+
+/*
+不使用DynamicArray：它的拷贝、赋值会重新申请空间，对齐的位置随之改变
+新的空间全部申请成功之后才拷贝、替换，申请失败时图保持不变
+大小和下标都用size_t计算，顶点数超过46341时 n * n 会超出int
+*/
+template<typename V, typename E>
+void DynamicMatrixGraph<V, E>::_reserve(int capacity){
+	if(capacity > m_capacity){
+		//一行的长度取整为ALIGN字节的整数倍
+		size_t n = capacity;
+		size_t wunit = (ALIGN % sizeof(E) == 0) ? ALIGN / sizeof(E) : 1;
+		size_t wstride = (n + wunit - 1) / wunit * wunit;
+		size_t bunit = ALIGN / sizeof(unsigned long long);
+		size_t bstride = ((n + 63) / 64 + bunit - 1) / bunit * bunit;
+
+		//多申请一个对齐单位，用于跳到对齐的位置
+		V* vertexes = NULL;
+		bool* assigned = NULL;
+		E* wbuf = NULL;
+		unsigned long long* bbuf = NULL;
+		unsigned long long* tbuf = NULL;
+		try{
+			vertexes = _alloc<V>(n, 1, 0);
+			assigned = _alloc<bool>(n, 1, 0);
+			wbuf = _alloc<E>(n, wstride, wunit);
+			bbuf = _alloc<unsigned long long>(n, bstride, bunit);
+			tbuf = _alloc<unsigned long long>(n, bstride, bunit);
+		}
+		catch(...){
+			delete[] vertexes;
+			delete[] assigned;
+			delete[] wbuf;
+			delete[] bbuf;
+			throw;
+		}
+		E* weight = _align(wbuf);
+		unsigned long long* bits = _align(bbuf);
+		unsigned long long* tbits = _align(tbuf);
+
+		for(int i = 0; i < capacity; i++){
+			assigned[i] = (i < m_vcount) && m_assigned[i];
+			if(assigned[i]){
+				vertexes[i] = m_vertexes[i];
+			}
+		}
+		for(size_t k = 0; k < n * bstride; k++){
+			bits[k] = 0;
+			tbits[k] = 0;
+		}
+		for(int i = 0; i < m_vcount; i++){
+			for(int j = 0; j < m_vcount; j++){
+				weight[i * wstride + j] = m_weight[i * m_wstride + j];
+			}
+			for(size_t w = 0; w < m_bstride; w++){
+				bits[i * bstride + w] = m_bits[i * m_bstride + w];
+				tbits[i * bstride + w] = m_tbits[i * m_bstride + w];
+			}
+		}
+
+		_free();
+		m_vertexes = vertexes;
+		m_assigned = assigned;
+		m_wbuf = wbuf;
+		m_bbuf = bbuf;
+		m_tbuf = tbuf;
+		m_weight = weight;
+		m_bits = bits;
+		m_tbits = tbits;
+		m_wstride = wstride;
+		m_bstride = bstride;
+		m_capacity = capacity;
+	}
+}
+
+template<typename V, typename E>
+void DynamicMatrixGraph<V, E>::_free(){
+	delete[] m_vertexes;
+	delete[] m_assigned;
+	delete[] m_wbuf;
+	delete[] m_bbuf;
+	delete[] m_tbuf;
+}
+
+template<typename V, typename E>
+bool DynamicMatrixGraph<V, E>::_test(int i, int j) const{
+	return (m_bits[i * m_bstride + (j >> 6)] >> (j & 63)) & 1;
+}
+
+template<typename V, typename E>
+int DynamicMatrixGraph<V, E>::_count(const unsigned long long* row) const{
+	int rst = 0;
+	for(size_t w = 0; w < m_bstride; w++){
+		rst += __builtin_popcountll(row[w]);
+	}
+	return rst;
+}
+
+template<typename V, typename E>
+V DynamicMatrixGraph<V, E>::GetVertex(int i){
+	V rst;
+	if(!GetVertex(i, rst)){
+		THROW_EXCEPTION(InvalidParameterException , "Paranmeter  i is not of range");
+	}
+	return rst;
+}
+
+template<typename V, typename E>
+bool DynamicMatrixGraph<V, E>::GetVertex(int i, V& value){
+	bool rst = CHECKBOUND(i);
+	if(rst){
+		if(m_assigned[i]){
+			value = m_vertexes[i];
+		}
+		else{
+			THROW_EXCEPTION(InvalidParameterException , "No value assigned to this vertex...");
+		}
+	}
+	return rst;
+}
+
+template<typename V, typename E>
+bool DynamicMatrixGraph<V, E>::SetVertex(int i, const V& value){
+	bool rst = CHECKBOUND(i);
+	if(rst){
+		m_vertexes[i] = value;
+		m_assigned[i] = true;
+	}
+	return rst;
+}
+
+//先用popcount确定数组大小，再按字扫描一遍写入
+template<typename V, typename E>
+SharedPointer<Array<int>> DynamicMatrixGraph<V, E>::GetAdjacent(int i){
+	DynamicArray<int>* rst = NULL;
+	if(CHECKBOUND(i)){
+		const unsigned long long* row = Bits(i);
+		rst = new DynamicArray<int>(_count(row));
+
+		if(rst != NULL){
+			int* a = rst->GetArray();
+			int k = 0;
+			for(size_t w = 0; w < m_bstride; w++){
+				//每次取出最低位的1，再将其清除
+				for(unsigned long long bits = row[w]; bits != 0; bits &= bits - 1){
+					a[k++] = (w << 6) + __builtin_ctzll(bits);
+				}
+			}
+		}
+		else{
+			THROW_EXCEPTION(NotEnoughMemoryException, "No memory to create new ret object...");
+		}
+	}
+	else{
+		THROW_EXCEPTION(InvalidParameterException , "Paranmeter  i is not of range");
+	}
+	return rst;
+}
+
+template<typename V, typename E>
+bool DynamicMatrixGraph<V, E>::FirstAdjacent(int i, AdjacentCursor<E>& c){
+	if(!CHECKBOUND(i)){
+		THROW_EXCEPTION(InvalidParameterException , "Paranmeter  i is not of range");
+	}
+	c.from = i;
+	c.pos = -1;
+	return NextAdjacent(c);
+}
+
+//从第pos + 1列开始，屏蔽掉当前字中已经访问过的低位，按字寻找下一个1
+template<typename V, typename E>
+bool DynamicMatrixGraph<V, E>::NextAdjacent(AdjacentCursor<E>& c){
+	const unsigned long long* row = Bits(c.from);
+	int j = c.pos + 1;
+	int to = -1;
+
+	if(j < m_vcount){
+		int w = j >> 6;
+		unsigned long long bits = row[w] & (~0ULL << (j & 63));
+		while((bits == 0) && (static_cast<size_t>(++w) < m_bstride)){
+			bits = row[w];
+		}
+		if(bits != 0){
+			to = (w << 6) + __builtin_ctzll(bits);
+		}
+	}
+
+	c.pos = (to >= 0) ? to : m_vcount;
+	c.to = to;
+	c.weight = (to >= 0) ? Row(c.from) + to : NULL;
+	return to >= 0;
+}
+
+template<typename V, typename E>
+E DynamicMatrixGraph<V, E>::GetEdge(int i, int j){
+	E rst;
+	if(!GetEdge(i, j, rst)){
+		THROW_EXCEPTION(InvalidParameterException, "Index <i, j> is invalid...");
+	}
+	return rst;
+}
+
+template<typename V, typename E>
+bool DynamicMatrixGraph<V, E>::GetEdge(int i, int j, E& value){
+	bool rst = CHECKBOUND(i) && CHECKBOUND(j);
+	if(rst){
+		if(_test(i, j)){
+			value = m_weight[i * m_wstride + j];
+		}
+		else{
+			THROW_EXCEPTION(InvalidParameterException , " No value assigned to this edge...");
+		}
+	}
+	return rst;
+}
+
+template<typename V, typename E>
+bool DynamicMatrixGraph<V, E>::SetEdge(int i, int j, const E& value){
+	bool rst = CHECKBOUND(i) && CHECKBOUND(j);
+	if(rst){
+		//先赋值，赋值抛出异常时位图不变
+		m_weight[i * m_wstride + j] = value;
+		if(!_test(i, j)){
+			m_bits[i * m_bstride + (j >> 6)] |= 1ULL << (j & 63);
+			m_tbits[j * m_bstride + (i >> 6)] |= 1ULL << (i & 63);
+			m_ecount++;
+		}
+		this->_invalidate();
+	}
+	return rst;
+}
+
+template<typename V, typename E>
+bool DynamicMatrixGraph<V, E>::RemoveEdge(int i, int j){
+	bool rst = CHECKBOUND(i) && CHECKBOUND(j);
+	if(rst && _test(i, j)){
+		m_bits[i * m_bstride + (j >> 6)] &= ~(1ULL << (j & 63));
+		m_tbits[j * m_bstride + (i >> 6)] &= ~(1ULL << (i & 63));
+		m_ecount--;
+		this->_invalidate();
+	}
+	return rst;
+}
+
+template<typename V, typename E>
+bool DynamicMatrixGraph<V, E>::IsAdjacent(int i, int j){
+	return CHECKBOUND(i) && CHECKBOUND(j) && _test(i, j);
+}
+
+template<typename V, typename E>
+int DynamicMatrixGraph<V, E>::VCount(){
+	return m_vcount;
+}
+
+template<typename V, typename E>
+int DynamicMatrixGraph<V, E>::ECount(){
+	return m_ecount;
+}
+
+template<typename V, typename E>
+int DynamicMatrixGraph<V, E>::OD(int i){
+	if(!CHECKBOUND(i)){
+		THROW_EXCEPTION(InvalidParameterException , "Paranmeter  i is not of range");
+	}
+	return _count(m_bits + i * m_bstride);
+}
+
+template<typename V, typename E>
+int DynamicMatrixGraph<V, E>::ID(int i){
+	if(!CHECKBOUND(i)){
+		THROW_EXCEPTION(InvalidParameterException , "Paranmeter  i is not of range");
+	}
+	return _count(m_tbits + i * m_bstride);
+}
+
+template<typename V, typename E>
+int DynamicMatrixGraph<V, E>::AddVertex(){
+	if(m_fixed){
+		THROW_EXCEPTION(InvalidOperationException, "Vertex count of current graph is fixed...");
+	}
+	if(m_vcount == m_capacity){
+		if(m_capacity > 0x3FFFFFFF){
+			THROW_EXCEPTION(NotEnoughMemoryException, "DynamicMatrixGraph is too large...");
+		}
+		_reserve(m_capacity ? m_capacity * 2 : 16);
+	}
+	//新顶点的行和列在_reserve或RemoveVertex中已经清零
+	m_assigned[m_vcount] = false;
+	return m_vcount++;
+}
+
+template<typename V, typename E>
+int DynamicMatrixGraph<V, E>::AddVertex(const V& value){
+	int i = AddVertex();
+	SetVertex(i, value);
+	return i;
+}
+
+/*
+清除最后一个顶点的行（出边）和列（入边），下一次AddVertex时可以直接使用
+*/
+template<typename V, typename E>
+void DynamicMatrixGraph<V, E>::RemoveVertex(){
+	if(m_fixed){
+		THROW_EXCEPTION(InvalidOperationException, "Vertex count of current graph is fixed...");
+	}
+	if(m_vcount > 0){
+		int v = m_vcount - 1;
+		unsigned long long* row = m_bits + v * m_bstride;
+		unsigned long long* col = m_tbits + v * m_bstride;
+
+		m_ecount -= _count(row) + _count(col) - (_test(v, v) ? 1 : 0);
+		for(int i = 0; i < v; i++){
+			m_bits[i * m_bstride + (v >> 6)] &= ~(1ULL << (v & 63));
+			m_tbits[i * m_bstride + (v >> 6)] &= ~(1ULL << (v & 63));
+		}
+		for(size_t w = 0; w < m_bstride; w++){
+			row[w] = 0;
+			col[w] = 0;
+		}
+		m_assigned[v] = false;
+		m_vcount--;
+		this->_invalidate();
+	}
+	else{
+		THROW_EXCEPTION(InvalidOperationException, "No vertex in current graph...");
+	}
+}
+
+template<typename V, typename E>
+int DynamicMatrixGraph<V, E>::Capacity() const{
+	return m_capacity;
+}
+
+template<typename V, typename E>
+const E* DynamicMatrixGraph<V, E>::Row(int i) const{
+	return m_weight + i * m_wstride;
+}
+
+template<typename V, typename E>
+const unsigned long long* DynamicMatrixGraph<V, E>::Bits(int i) const{
+	return m_bits + i * m_bstride;
+}
+
+template<typename V, typename E>
+DynamicMatrixGraph<V, E>::~DynamicMatrixGraph(){
+	_free();
+}
+
+/*
+Test code
+	int n;
+	cin>>n;
+	DynamicMatrixGraph<int, int> g(n);
+	g.SetEdge(0, 1, 5);
+	int v = g.AddVertex(100);		//n
+	g.SetEdge(v, 0, 7);
+
+	cout<<g.VCount()<<" "<<g.ECount()<<endl;		//n + 1, 2
+	cout<<g.GetEdge(v, 0)<<" "<<g.ID(0)<<endl;		//7 1
+
+	g.RemoveVertex();
+	cout<<g.ECount()<<endl;						//1
+*/
+
+}
+
+#endif
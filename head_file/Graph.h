@@ -9,6 +9,8 @@
 #include "LinkStack.h"
 #include "DynamicArray.h"
 #include "Sort.h"
+#include "IndexedHeap.h"
+#include "DisjointSet.h"
 
 
 
@@ -54,6 +56,439 @@ struct Edge: public Object{
 };
 
 
+/*
+邻接游标（AdjacentCursor）
+	GetAdjacent(i)每次都要申请一个DynamicArray和SharedPointer的计数，MatrixGraph还要扫描两遍一行
+	BFS、DFS、Prim、Dijkstra对每个顶点都要调用一次，申请内存的代价远大于遍历本身
+
+	游标不申请任何空间，由调用者在栈上定义，通过Graph的虚函数移动：
+		FirstAdjacent(i, c)		定位到i的第一条边，没有边时返回false
+		NextAdjacent(c)			移动到下一条边，没有边时返回false
+	当前边为<from, to>，weight指向图中保存的权值（不拷贝），pos、node由具体的图使用：
+		MatrixGraph		pos为列号
+		ListGraph		node为边链表中的位置（LinkList::Position）
+		CSRGraph		pos为边在数组中的下标
+
+	AdjacentCursor<int> c;
+	for(bool ok = g.FirstAdjacent(i, c); ok; ok = g.NextAdjacent(c)){
+		cout<<c.to<<" "<<*c.weight<<endl;
+	}
+
+	遍历过程中不能修改图（SetEdge、RemoveEdge等），否则游标失效
+*/
+template<typename E>
+struct AdjacentCursor: public Object{
+	int from;
+	int to;					//当前邻接顶点，没有时为-1
+	const E* weight;		//当前边的权值
+	int pos;
+	const void* node;
+
+	AdjacentCursor(){
+		from = -1;
+		to = -1;
+		weight = NULL;
+		pos = -1;
+		node = NULL;
+	}
+};
+
+/*
+Dijkstra的工作空间
+	一次查询需要dist、path两个长度为n的数组和一个堆，每次查询都重新申请，对大图的多次查询开销很大
+	工作空间在多次查询之间复用：
+		数组只在顶点数增加时重新申请
+		记录上一次查询访问过的顶点（touched），下一次查询只重置这些顶点，提前结束的查询不需要O(n)的初始化
+
+	查询结束后：
+		Distance(v)		起点到v的最短距离，不可达为LIMIT
+		Path(v)			最短路径上v的前驱，起点和不可达的顶点为-1
+		PathTo(v)		起点到v的路径（包含两个端点），不可达时长度为0
+		Distance()、Path()	完整的数组，只有前VCount()项有效（数组只增长不缩小，之后的部分是以前在更大的图上查询留下的）
+
+堆：
+	IndexedHeap（4叉索引堆），以dist为键值，可以直接修改顶点的键值（decrease-key），不需要插入重复的顶点
+	提前结束的查询堆中还有剩余的顶点，IndexedHeap::Clear()只重置这些顶点
+*/
+template<typename E>
+class DijkstraWorkspace: public Object{
+protected:
+	DynamicArray<E> m_dist;
+	DynamicArray<int> m_path;
+	IndexedHeap<E> m_heap;
+	DynamicArray<int> m_touched;	//dist被修改过的顶点
+	int m_tcount;					//touched的个数
+	int m_vcount;
+	int m_source;
+	E m_limit;
+
+	//准备一次新的查询
+	void _reset(int n, const E& LIMIT);
+	//v不在堆中时插入，已在堆中时上浮（d只会减小）
+	void _update(int v, const E& d, int prev);
+	int _pop();
+
+	template<typename V, typename F>
+	friend class Graph;
+public:
+	DijkstraWorkspace(int n = 0);
+
+	int Source() const;
+	//上一次查询的图的顶点数
+	int VCount() const;
+	E Distance(int v) const;
+	int Path(int v) const;
+	bool Reached(int v) const;
+	SharedPointer<Array<int>> PathTo(int v) const;
+
+	//完整的数组，长度可能大于VCount()，只有前VCount()项有效
+	const Array<E>& Distance() const;
+	const Array<int>& Path() const;
+};
+
+template<typename E>
+DijkstraWorkspace<E>::DijkstraWorkspace(int n): m_heap(n){
+	m_tcount = 0;
+	m_vcount = 0;
+	m_source = -1;
+
+	if(n > 0){
+		m_dist.resize(n);
+		m_path.resize(n);
+		m_touched.resize(n);
+	}
+}
+
+template<typename E>
+void DijkstraWorkspace<E>::_reset(int n, const E& LIMIT){
+	E* dist = m_dist.GetArray();
+	int* path = m_path.GetArray();
+
+	m_heap.Clear();
+	if((n != m_vcount) || !(LIMIT == m_limit)){
+		//顶点数或者LIMIT改变时整体重置
+		if(static_cast<unsigned int>(n) > m_dist.Length()){
+			m_dist.resize(n);
+			m_path.resize(n);
+			m_heap.Resize(n);
+			m_touched.resize(n);
+			dist = m_dist.GetArray();
+			path = m_path.GetArray();
+		}
+		for(int v = 0; v < n; v++){
+			dist[v] = LIMIT;
+			path[v] = -1;
+		}
+		m_vcount = n;
+		m_limit = LIMIT;
+	}
+	else{
+		const int* touched = m_touched.GetArray();
+		for(int k = 0; k < m_tcount; k++){
+			int v = touched[k];
+			dist[v] = LIMIT;
+			path[v] = -1;
+		}
+	}
+	m_tcount = 0;
+}
+
+template<typename E>
+void DijkstraWorkspace<E>::_update(int v, const E& d, int prev){
+	if((m_path.GetArray()[v] == -1) && (m_dist.GetArray()[v] == m_limit)){
+		m_touched.GetArray()[m_tcount++] = v;
+	}
+	m_dist.GetArray()[v] = d;
+	m_path.GetArray()[v] = prev;
+
+	if(m_heap.Contains(v)){
+		m_heap.DecreaseKey(v, d);
+	}
+	else{
+		m_heap.Push(v, d);
+	}
+}
+
+template<typename E>
+int DijkstraWorkspace<E>::_pop(){
+	return m_heap.Pop();
+}
+
+template<typename E>
+int DijkstraWorkspace<E>::Source() const{
+	return m_source;
+}
+
+template<typename E>
+int DijkstraWorkspace<E>::VCount() const{
+	return m_vcount;
+}
+
+template<typename E>
+E DijkstraWorkspace<E>::Distance(int v) const{
+	if((v >= 0) && (v < m_vcount)){
+		return m_dist.GetArray()[v];
+	}
+	else{
+		THROW_EXCEPTION(InvalidParameterException, "index v is invalid...");
+	}
+}
+
+template<typename E>
+int DijkstraWorkspace<E>::Path(int v) const{
+	if((v >= 0) && (v < m_vcount)){
+		return m_path.GetArray()[v];
+	}
+	else{
+		THROW_EXCEPTION(InvalidParameterException, "index v is invalid...");
+	}
+}
+
+template<typename E>
+bool DijkstraWorkspace<E>::Reached(int v) const{
+	return (v >= 0) && (v < m_vcount) && ((v == m_source) || (m_path.GetArray()[v] != -1));
+}
+
+template<typename E>
+SharedPointer<Array<int>> DijkstraWorkspace<E>::PathTo(int v) const{
+	DynamicArray<int>* rst = NULL;
+
+	//先数出路径的长度，再从终点向前填写
+	int len = 0;
+	if(Reached(v)){
+		for(int k = v; k != -1; k = m_path.GetArray()[k]){
+			len++;
+		}
+	}
+
+	rst = new DynamicArray<int>(len);
+	if(rst != NULL){
+		int k = v;
+		for(int t = len - 1; t >= 0; t--){
+			rst->GetArray()[t] = k;
+			k = m_path.GetArray()[k];
+		}
+	}
+	else{
+		THROW_EXCEPTION(NotEnoughMemoryException, "no memory to create ret obj...");
+	}
+	return rst;
+}
+
+template<typename E>
+const Array<E>& DijkstraWorkspace<E>::Distance() const{
+	return m_dist;
+}
+
+template<typename E>
+const Array<int>& DijkstraWorkspace<E>::Path() const{
+	return m_path;
+}
+
+/*
+Floyd的结果（任意两点之间的最短距离）
+	dist和next都是n * n的一维数组，按行存放，(i, j)在 i * n + j
+		m_dist[i * n + j]	i到j的最短距离，不可达为LIMIT
+		m_next[i * n + j]	i到j的最短路径上i之后的第一个顶点（即原来的path[i][j]），不可达为-1
+		dist[i][i]为0，next[i][i]为i
+	一次计算之后可以回答任意两点的查询，结果可以在多次计算之间复用（顶点数不增加时不重新申请）
+
+分块（tiled）Floyd：
+	直接的三重循环每一轮k都要扫描整个矩阵，n较大时矩阵放不进缓存，每一轮都从内存读写n^2个元素
+	把矩阵分成BLOCK * BLOCK的块，第kb轮（中转顶点为第kb块中的顶点）分三个阶段：
+		1.对角块(kb, kb)，只依赖自己
+		2.第kb行和第kb列的块，只依赖自己和对角块，相互独立
+		3.其余的块(bi, bj)，只依赖(bi, kb)和(kb, bj)，相互独立
+	每个块的计算只访问三个块（约3 * BLOCK * BLOCK个元素），都在缓存中
+	第2、3阶段中的块可以并行计算（OpenMP，编译时没有-fopenmp时不定义_OPENMP，单线程执行）
+
+	最内层的循环对一行做 d[i][j] = min(d[i][j], d[i][k] + d[k][j])，不调用虚函数，没有分支，编译器可以向量化
+	d[i][k]为LIMIT时整行跳过；d[k][j]为LIMIT时候选值无效（与原来的实现相同，要求LIMIT + 边权不溢出）
+*/
+template<typename E>
+class FloydResult: public Object{
+protected:
+	enum{ BLOCK = 64 };
+
+	DynamicArray<E> m_dist;
+	DynamicArray<int> m_next;
+	int m_vcount;
+	E m_limit;
+
+	//初始化为n个顶点，dist全部为LIMIT，next全部为-1
+	void _reset(int n, const E& LIMIT);
+	//以k为中转顶点的[kb, ke)，更新[ib, ie) * [jb, je)的块
+	void _block(int ib, int ie, int jb, int je, int kb, int ke);
+	void _solve();
+
+	template<typename V, typename F>
+	friend class Graph;
+public:
+	FloydResult();
+
+	int VCount() const;
+	E Distance(int i, int j) const;
+	int Next(int i, int j) const;
+	bool Reached(int i, int j) const;
+	//i到j的路径（包含两个端点），不可达时长度为0
+	SharedPointer<Array<int>> PathTo(int i, int j) const;
+};
+
+template<typename E>
+FloydResult<E>::FloydResult(){
+	m_vcount = 0;
+}
+
+template<typename E>
+void FloydResult<E>::_reset(int n, const E& LIMIT){
+	unsigned int size = static_cast<unsigned int>(n) * static_cast<unsigned int>(n);
+	if(size > m_dist.Length()){
+		m_dist.resize(size);
+		m_next.resize(size);
+	}
+
+	E* dist = m_dist.GetArray();
+	int* next = m_next.GetArray();
+	for(unsigned int t = 0; t < size; t++){
+		dist[t] = LIMIT;
+		next[t] = -1;
+	}
+	m_vcount = n;
+	m_limit = LIMIT;
+}
+
+template<typename E>
+void FloydResult<E>::_block(int ib, int ie, int jb, int je, int kb, int ke){
+	const int n = m_vcount;
+	const E LIMIT = m_limit;
+	E* dist = m_dist.GetArray();
+	int* next = m_next.GetArray();
+
+	for(int k = kb; k < ke; k++){
+		const E* dk = dist + k * n;
+		for(int i = ib; i < ie; i++){
+			E* di = dist + i * n;
+			int* ni = next + i * n;
+			const E dik = di[k];
+			if(dik == LIMIT){
+				continue;
+			}
+			const int nik = ni[k];
+
+			for(int j = jb; j < je; j++){
+				const E c = dik + dk[j];
+				const bool better = (dk[j] != LIMIT) & (c < di[j]);
+				di[j] = better ? c : di[j];
+				ni[j] = better ? nik : ni[j];
+			}
+		}
+	}
+}
+
+template<typename E>
+void FloydResult<E>::_solve(){
+	const int n = m_vcount;
+	const int nb = (n + BLOCK - 1) / BLOCK;
+
+	for(int kb = 0; kb < nb; kb++){
+		const int k0 = kb * BLOCK;
+		const int k1 = (k0 + BLOCK < n) ? k0 + BLOCK : n;
+
+		//1.对角块
+		_block(k0, k1, k0, k1, k0, k1);
+
+		//2.第kb行、第kb列的块
+		#ifdef _OPENMP
+		#pragma omp parallel for schedule(dynamic)
+		#endif
+		for(int b = 0; b < nb; b++){
+			if(b != kb){
+				const int b0 = b * BLOCK;
+				const int b1 = (b0 + BLOCK < n) ? b0 + BLOCK : n;
+				_block(k0, k1, b0, b1, k0, k1);
+				_block(b0, b1, k0, k1, k0, k1);
+			}
+		}
+
+		//3.其余的块
+		#ifdef _OPENMP
+		#pragma omp parallel for schedule(dynamic)
+		#endif
+		for(int t = 0; t < nb * nb; t++){
+			const int bi = t / nb;
+			const int bj = t % nb;
+			if((bi != kb) && (bj != kb)){
+				const int i0 = bi * BLOCK;
+				const int i1 = (i0 + BLOCK < n) ? i0 + BLOCK : n;
+				const int j0 = bj * BLOCK;
+				const int j1 = (j0 + BLOCK < n) ? j0 + BLOCK : n;
+				_block(i0, i1, j0, j1, k0, k1);
+			}
+		}
+	}
+}
+
+template<typename E>
+int FloydResult<E>::VCount() const{
+	return m_vcount;
+}
+
+template<typename E>
+E FloydResult<E>::Distance(int i, int j) const{
+	if((i >= 0) && (i < m_vcount) && (j >= 0) && (j < m_vcount)){
+		return m_dist.GetArray()[i * m_vcount + j];
+	}
+	else{
+		THROW_EXCEPTION(IndexOutOfBoundsException, "Index<i,j> is invalid...");
+	}
+}
+
+template<typename E>
+int FloydResult<E>::Next(int i, int j) const{
+	if((i >= 0) && (i < m_vcount) && (j >= 0) && (j < m_vcount)){
+		return m_next.GetArray()[i * m_vcount + j];
+	}
+	else{
+		THROW_EXCEPTION(IndexOutOfBoundsException, "Index<i,j> is invalid...");
+	}
+}
+
+template<typename E>
+bool FloydResult<E>::Reached(int i, int j) const{
+	return Next(i, j) != -1;
+}
+
+template<typename E>
+SharedPointer<Array<int>> FloydResult<E>::PathTo(int i, int j) const{
+	const int* next = m_next.GetArray();
+	int len = 0;
+
+	if(Reached(i, j)){
+		//有负权回路时路径不存在，最多走n步
+		int v = i;
+		len = 1;
+		while((v != j) && (v != -1) && (len <= m_vcount)){
+			v = next[v * m_vcount + j];
+			len++;
+		}
+		if(v != j){
+			len = 0;
+		}
+	}
+
+	DynamicArray<int>* rst = new DynamicArray<int>(len);
+	if(rst == NULL){
+		THROW_EXCEPTION(NotEnoughMemoryException, "no memory to create ret obj...");
+	}
+
+	int v = i;
+	for(int k = 0; k < len; k++){
+		(*rst)[k] = v;
+		v = next[v * m_vcount + j];
+	}
+	return rst;
+}
+
 
 /*
 图：
@@ -101,18 +536,37 @@ protected:
 
 	void _visit(int i, DynamicArray<bool>& visited, LinkQueue<int>& q);
 
-	int _find(Array<int>& p, int v);
+	//Prim中堆的比较函数，Min时权值小的先出堆，Max时权值大的先出堆
+	struct _Order: public Object{
+		bool min;
+		_Order(bool m = true){
+			min = m;
+		}
+		bool operator ()(const E& a, const E& b) const{
+			return min ? (a < b) : (b < a);
+		}
+	};
+
+	//IsUndirected()的缓存：1是无向图，0不是，-1需要重新计算
+	int m_undirected;
+	//子类修改边（SetEdge、RemoveEdge、RemoveVertex）之后调用，使缓存失效
+	void _invalidate();
 public:
 	enum MaxOrMin{
 		Max,
 		Min
 	};
+	Graph();
+
 	virtual V GetVertex(int i) = 0;
 	virtual bool GetVertex(int i, V& value) = 0;
 
 	virtual bool SetVertex(int i, const V& value) = 0;
 	
 	virtual SharedPointer<Array<int> > GetAdjacent(int i) = 0;
+	//不申请空间的邻接顶点遍历，见AdjacentCursor
+	virtual bool FirstAdjacent(int i, AdjacentCursor<E>& c) = 0;
+	virtual bool NextAdjacent(AdjacentCursor<E>& c) = 0;
 
 	virtual bool IsAdjacent(int i, int j) = 0;
 
@@ -145,10 +599,16 @@ public:
 	SharedPointer< Array<Edge<E>>> GetUndirectedEdge();
 
 	SharedPointer< Array<Edge<E>>> Kruskal( const MaxOrMin model = Min);
+	//连通分量，返回每个顶点所在分量的编号（0 ~ 分量个数 - 1）
+	SharedPointer< Array<int> > Components();
 
 	SharedPointer< Array<int> > Dijkstra(int i, int j, const E& LIMIT);
+	//单源最短路，结果保存在ws中，target >= 0时到达target之后提前结束
+	void Dijkstra(int i, DijkstraWorkspace<E>& ws, const E& LIMIT, int target = -1);
 
 	SharedPointer< Array<int> > Floyd(int x, int y, const E& LIMIT);
+	//任意两点最短路，结果保存在rst中
+	void Floyd(FloydResult<E>& rst, const E& LIMIT);
 };
 
 template <typename V, typename E>
@@ -205,39 +665,44 @@ ListGraph适用于内存资源受限的场合（节省空间）
 		3.判断队列是否为空
 
 因为返回值默认带有顺序，所以用数组最好
+结果数组本身就可以作为队列（每个顶点只入队一次），邻接顶点通过AdjacentCursor遍历，不需要LinkQueue和GetAdjacent
 */
 template <typename V, typename E>
 SharedPointer<Array<int> > Graph<V, E>::BFS(int i){
 	DynamicArray<int>* rst = NULL;
 
 	if((i >= 0) && (i < VCount())){
-		LinkQueue<int> q;
-		LinkQueue<int> r;
+		//结果数组本身作为队列：[head, tail)为队列中的顶点，[0, head)为已经出队的顶点
+		rst = new DynamicArray<int>(VCount());
+		if(rst == NULL){
+			THROW_EXCEPTION(NotEnoughMemoryException, "no memory to create ret obj...");
+		}
+		int* q = rst->GetArray();
+		int head = 0;
+		int tail = 0;
+
 		DynamicArray<bool> visited(VCount());
 		//初始化动态数组，将默认值赋false
-		for(int i = 0; i < visited.Length(); i++){
-			visited[i] = false;
+		for(int k = 0; k < visited.Length(); k++){
+			visited[k] = false;
 		}
 
-		q.Add(i);
+		q[tail++] = i;
 		visited[i] = true;
-		
-		while(q.Length() > 0){
-			int temp = q.Front();
 
-			SharedPointer<Array<int> > ae= GetAdjacent(temp);
-
-			q.Remove();
+		AdjacentCursor<E> c;
+		while(head < tail){
+			int temp = q[head++];
 
-			for(int i = (r.Add(temp), 0); i< ae->Length(); i++){
-				if(visited[(*ae)[i]] == false){
-					q.Add((*ae)[i]);
-					visited[(*ae)[i]] = true;
+			for(bool ok = FirstAdjacent(temp, c); ok; ok = NextAdjacent(c)){
+				if(visited[c.to] == false){
+					q[tail++] = c.to;
+					visited[c.to] = true;
 				}
-
 			}
 		}
-		rst = ToArray(r);
+		//只保留访问到的顶点
+		rst->resize(tail);
 	}
 	else{
 		THROW_EXCEPTION(InvalidParameterException,  "index i is invalid...");
@@ -264,42 +729,52 @@ SharedPointer<Array<int> > Graph<V, E>::BFS(int i){
 
 
 因为返回值默认带有顺序，所以用数组最好
+
+上面的方法每个顶点的全部邻接顶点都要入栈，栈的大小为O(e)
+现在栈中保存每一层的AdjacentCursor，出栈时游标移动到下一个邻接顶点，访问顺序与上面的方法相同，栈的大小不超过n
 */
 template <typename V, typename E>
 SharedPointer<Array<int> > Graph<V, E>::DFS(int i){
 	DynamicArray<int>* rst = NULL; 
 	if((i >= 0) && ( i < VCount())){
+		rst = new DynamicArray<int>(VCount());
+		if(rst == NULL){
+			THROW_EXCEPTION(NotEnoughMemoryException, "no memory to create ret obj...");
+		}
+		int count = 0;
 
 		DynamicArray<bool> visited(VCount());
-		LinkQueue<int> rq;
-		LinkStack<int> s;
-
-		for(int i = 0; i < visited.Length(); i++){
-			visited[i] = false;
+		for(int k = 0; k < visited.Length(); k++){
+			visited[k] = false;
 		}
-		
-		s.Push(i);
-		
-		while(s.Size() > 0){
 
-			int temp = s.Top();
-			s.Pop();
+		//栈中保存每一层的游标，栈顶的游标指向下一个要检查的邻接顶点，每个顶点最多入栈一次
+		DynamicArray<AdjacentCursor<E> > s(VCount());
+		int top = 0;
 
-			if(visited[temp] == false){
-				
-				SharedPointer<Array<int>> ad = GetAdjacent(temp);
+		visited[i] = true;
+		(*rst)[count++] = i;
+		if(FirstAdjacent(i, s[top])){
+			top++;
+		}
 
-				visited[temp] = true;
-				rq.Add(temp);
+		while(top > 0){
+			AdjacentCursor<E>& c = s[top - 1];
+			int v = c.to;
+			//当前层移动到下一个邻接顶点，没有时出栈（回退）
+			if(!NextAdjacent(c)){
+				top--;
+			}
 
-				for(int i = (ad->Length() - 1); i >= 0; i--){
-						s.Push((*ad)[i]);
+			if(visited[v] == false){
+				visited[v] = true;
+				(*rst)[count++] = v;
+				if(FirstAdjacent(v, s[top])){
+					top++;
 				}
 			}
-
 		}
-		rst = ToArray(rq);
-
+		rst->resize(count);
 	}
 	else{
 		THROW_EXCEPTION(InvalidParameterException,  "index i is invalid...");
@@ -314,10 +789,9 @@ void Graph<V, E>::_visit(int i, DynamicArray<bool>& visited, LinkQueue<int>& q){
 		q.Add(i);
 		visited[i] = true;
 		
-		SharedPointer<Array<int>> sa= GetAdjacent(i);
-		
-		for(int k = 0; k < sa->Length(); k++){
-			_visit((*sa)[k], visited, q);
+		AdjacentCursor<E> c;
+		for(bool ok = FirstAdjacent(i, c); ok; ok = NextAdjacent(c)){
+			_visit(c.to, visited, q);
 		}
 	}
 	
@@ -346,21 +820,37 @@ void Graph<V, E>::DFS(int i, SharedPointer<Array<int> >& sa){
 }
 
 
+template <typename V, typename E>
+Graph<V, E>::Graph(){
+	m_undirected = -1;
+}
+
+template <typename V, typename E>
+void Graph<V, E>::_invalidate(){
+	m_undirected = -1;
+}
+
+/*
+只检查存在的边（AdjacentCursor），O(e)次IsAdjacent、GetEdge，而不是n^2次
+结果缓存在m_undirected中，图没有修改时再次调用为O(1)
+*/
 template <typename V, typename E>
 bool Graph<V, E>::IsUndirected(){
-	//图中一个点都没有的情况，是无向图，返回true
-	bool rst = true;
-	//只要又一条边不满足要求，那么就不是无向图
-	for(int i= 0; rst && i < VCount(); i++){
-		for(int j = 0; rst && j < VCount(); j++){
-			//如果（i， j）是一条边，那么检测（j, i）是否也是一条边，并且权值相同
-
-			if(IsAdjacent(i, j)){
-				rst = rst && (IsAdjacent(j, i)) &&(GetEdge(i, j) == GetEdge(j, i));
+	if(m_undirected < 0){
+		//图中一个点都没有的情况，是无向图，返回true
+		bool rst = true;
+		//只要又一条边不满足要求，那么就不是无向图
+		for(int i= 0; rst && i < VCount(); i++){
+			AdjacentCursor<E> c;
+			for(bool ok = FirstAdjacent(i, c); rst && ok; ok = NextAdjacent(c)){
+				//如果（i， j）是一条边，那么检测（j, i）是否也是一条边，并且权值相同
+				int j = c.to;
+				rst = IsAdjacent(j, i) && (*c.weight == GetEdge(j, i));
 			}
 		}
+		m_undirected = rst ? 1 : 0;
 	}
-	return rst;
+	return m_undirected == 1;
 }
 /*
 最小生成树：
@@ -421,6 +911,13 @@ prim证明：
 T集合就是生成树中点的集合
 F集合就是没有连接到树的点的集合
 
+基于堆的实现：
+	原来的实现每一轮都扫描全部n个顶点寻找离树最近的点，总是O(n^2)，与边的数量无关
+	F集合中与树相连的点放在IndexedHeap中，键值为到树的距离：
+		出堆的点就是离树最近的点，O(log(n))
+		只更新新加入点的邻接顶点，距离变小时DecreaseKey
+	总的复杂度为O(e * log(n))，稀疏图（e远小于n^2）时快得多
+
 */
 template <typename V, typename E>
 SharedPointer<Array<Edge<E>>> Graph<V, E>::Prim(const E& LIMIT, MaxOrMin model ){
@@ -431,57 +928,48 @@ SharedPointer<Array<Edge<E>>> Graph<V, E>::Prim(const E& LIMIT, MaxOrMin model )
 		DynamicArray<bool> mark(VCount());
 		//记录cost权值对应顶点
 		DynamicArray<int> adjVex(VCount());
-		//记录T集合到F集合的对应顶点，即没链接到树上的点的集合到树的距离,NULL代表空，还没有访问过的点
-		DynamicArray<E> cost(VCount());
+		//F集合中与树相连的点，键值为到树的距离（cost）
+		_Order order(model == Min);
+		IndexedHeap<E, _Order> heap(VCount(), order);
 
 		for(int i = 0; i < VCount(); i++){
 			mark[i] = false;
 			adjVex[i] = -1;
-			cost[i] = LIMIT;
 		}
-		//初始化T集合，放入一个点到T集合，默认是索引为0个点。
-		int initv = 0;
-		mark[initv] = true;
-		SharedPointer<Array<int>> aj = GetAdjacent(initv);
-		//初始化adjVex和cost矩阵，即将和索引为0相连的点，更新到表中
-		for(int i = 0; i < aj->Length(); i++){
-			cost[(*aj)[i]] = GetEdge(initv, (*aj)[i]);
-			adjVex[(*aj)[i]] = initv;
+
+		//初始化T集合，放入一个点到T集合，默认是索引为0个点。没有对应的边，键值不会被使用
+		if(VCount() > 0){
+			heap.Push(0, LIMIT);
 		}
 
 		//从F集合将点逐个移动到T集合
-		bool end = false;
-		for(int i = 0; !end && i < VCount(); i++){
-			//寻找不在树中，且离树最近的点,标记为k,若k = -1，则证明没有相连的点，无法构成树
-			int k = -1;
-			E temp = LIMIT;
-			for(int j = 0; j < VCount();j++ ){
-				if(!mark[j] && (model ? (cost[j] < temp) : (cost[j] > temp))){
-					temp = cost[j];
-					k = j;
-				}
-			
+		while(heap.Length() > 0){
+			//离树最近的点k，以及它到树的距离
+			E value = heap.TopKey();
+			int k = heap.Pop();
+			mark[k] = true;
+			if(adjVex[k] >= 0){
+				//将(adjVex[k], k)边加入结果队列
+				rst.Add(Edge<E>(adjVex[k], k, value));
 			}
-			//若没有找到点，证明查找完毕
-			end = (k == -1);
-			if(!end){
-				//将k点从F集合移到T集合
-				mark[k] = true;
-				//将(adjVex[i], k),权值为*cost[k]的边加入结果队列
-				rst.Add(Edge<E>(adjVex[k], k, cost[k]));
-				//更新各个点到树的距离，adjVex[]，cost[]
-				aj = GetAdjacent(k);
-				
-				for(int j = 0; j < aj->Length(); j++){
-					E value = GetEdge(k,(*aj)[j]);
-					if(!mark[(*aj)[j]] && (model ? (value < cost[(*aj)[j]]) : (value > cost[(*aj)[j]]))){
-						cost[(*aj)[j]] = value;
-						adjVex[(*aj)[j]] = k;
+
+			//更新各个点到树的距离，只需要考虑k的邻接顶点
+			AdjacentCursor<E> c;
+			for(bool ok = FirstAdjacent(k, c); ok; ok = NextAdjacent(c)){
+				int v = c.to;
+				if(!mark[v]){
+					const E& w = *c.weight;
+					if(!heap.Contains(v)){
+						heap.Push(v, w);
+						adjVex[v] = k;
+					}
+					else if(order(w, heap.Key(v))){
+						heap.DecreaseKey(v, w);
+						adjVex[v] = k;
 					}
 				}
 			}
 		}
-
 	}
 	//无向图抛异常
 	else{
@@ -525,6 +1013,8 @@ SharedPointer<Array<Edge<E>>> Graph<V, E>::Prim(const E& LIMIT, MaxOrMin model )
 	如果从前驱数组能够查询到同样的端点，那么就意味着有回路
 	前驱数组
 	Kruskal算法本质就是寻找最小的前N-1条不构成回路的边，作为最小生成树
+
+	前驱数组没有路径压缩，一次查找最坏为O(n)，现在使用DisjointSet（路径减半 + 按大小合并），查找均摊O(α(n))
 */
 
 /*
@@ -536,49 +1026,31 @@ SharedPointer< Array<Edge<E>>> Graph<V, E>::GetUndirectedEdge(){
 		THROW_EXCEPTION(InvalidOperationException, "This function is for undirected graph only...");
 	}
 	LinkQueue<Edge<E>> rst;
+	AdjacentCursor<E> c;
 	for(int i = 0; i < VCount(); i++){
-		for(int j = i; j < VCount(); j++){
-			if(IsAdjacent(i, j)){
-				rst.Add(Edge<E>(i, j, GetEdge(i, j)));
+		for(bool ok = FirstAdjacent(i, c); ok; ok = NextAdjacent(c)){
+			if(c.to >= i){
+				rst.Add(Edge<E>(i, c.to, *c.weight));
 			}
 		}
 	}
 	return ToArray(rst);
 }
 
-//通过前驱数组寻找连通的各个vertex的顶点
-template <typename V, typename E>
-int Graph<V, E>::_find(Array<int>& p, int v){
-	//-1代表到达顶点
-	while(p[v] != -1){
-		v = p[v];
-	}
-	return v;
-}
-
-
 template <typename V, typename E>
 SharedPointer< Array<Edge<E>>> Graph<V, E>::Kruskal(const MaxOrMin model){
 	// 得到无向图所有的边， 在GetUndirectedEdge()函数中检测是否为无向图，若不是抛异常
 	SharedPointer< Array<Edge<E>>> edge = GetUndirectedEdge();
 	LinkQueue<Edge<E>> rst;
-	//前驱标记数组
-	DynamicArray<int> p(VCount());
-	for(int i = 0; i < p.Length(); i++){
-		p[i] = -1;
-	}
+	//并查集代替前驱标记数组
+	DisjointSet ds(VCount());
 
 	//使用数组类排序函数
 	Sort::Shell_Sort(*edge, model);
-	for(int i = 0; i < edge->Length() && rst.Length() < VCount() ; i++){
-		//通过前驱数组寻找顶点
-		int h = _find(p, (*edge)[i].b);
-		int t = _find(p, (*edge)[i].e);
-		//查看端点是否相同，不相同则构成环
-		if(h != t){
+	for(int i = 0; i < edge->Length() && ds.Count() > 1; i++){
+		//端点已经在同一个集合中时，加入这条边会构成环
+		if(ds.Union((*edge)[i].b, (*edge)[i].e)){
 			rst.Add((*edge)[i]);
-			//更新前驱标记数组,记录t点的前驱为h
-			p[t] = h;
 		}
 	}
 
@@ -589,6 +1061,43 @@ SharedPointer< Array<Edge<E>>> Graph<V, E>::Kruskal(const MaxOrMin model){
 	return ToArray(rst);
 }
 
+/*
+连通分量
+	对每条边合并两个端点所在的集合，最后同一个集合中的顶点属于同一个连通分量
+	有向图不考虑边的方向（弱连通分量）
+	分量按照其中最小的顶点排序编号，分量个数为最大编号 + 1
+*/
+template <typename V, typename E>
+SharedPointer< Array<int> > Graph<V, E>::Components(){
+	DisjointSet ds(VCount());
+	AdjacentCursor<E> c;
+	for(int i = 0; i < VCount(); i++){
+		for(bool ok = FirstAdjacent(i, c); ok; ok = NextAdjacent(c)){
+			ds.Union(i, c.to);
+		}
+	}
+
+	DynamicArray<int>* rst = new DynamicArray<int>(VCount());
+	if(rst == NULL){
+		THROW_EXCEPTION(NotEnoughMemoryException, "no memory to create ret obj...");
+	}
+
+	//根第一次出现时分配编号
+	DynamicArray<int> id(VCount());
+	for(int i = 0; i < VCount(); i++){
+		id[i] = -1;
+	}
+	int count = 0;
+	for(int i = 0; i < VCount(); i++){
+		int r = ds.Find(i);
+		if(id[r] < 0){
+			id[r] = count++;
+		}
+		(*rst)[i] = id[r];
+	}
+	return rst;
+}
+
 
 /*
 寻最短路：
@@ -647,78 +1156,64 @@ LIMIT是
 */
 template<typename V, typename E>
 SharedPointer< Array<int> > Graph<V, E>::Dijkstra(int i, int j, const E& LIMIT){
-	LinkQueue<int> rst;
-	LinkStack<int>	s;
+	SharedPointer< Array<int> > rst = NULL;
 
 	//检测端点合法性
 	if((i >= 0) && (i < VCount()) &&  (j >= 0) && ( j < VCount())){
-		DynamicArray<int> path(VCount());
-		DynamicArray<E> dist(VCount());
-		//标记是否已进入集合S
-		DynamicArray<bool> mark(VCount());
+		DijkstraWorkspace<E> ws(VCount());
+		Dijkstra(i, ws, LIMIT, j);
+		rst = ws.PathTo(j);
+	}
+	else{
+		THROW_EXCEPTION(InvalidOperationException, "Index<i,j> is invalid...");
+	}
 
-		//初始化数组：
-		for(int k = 0; k < VCount(); k++){
-			
-			path[k] = -1;
-			//将和i点相连的边提取出，更新前驱数组
-			dist[k] = IsAdjacent(i, k)? (path[k] = i, GetEdge(i, k)) :  LIMIT;
-			mark[k] = false;
-		}
-
-		//初始化S集合
-		//将i点放入集合中
-		mark[i] = true;
-
-		//循环迭代，寻找i到k点的最小路径
-		for(int k = 0; k < VCount(); k++){
-			//通过前驱数组寻找到i到h的最小路径
-			int minp = -1;
-			E te = LIMIT;
-			for(int h = 0; h < VCount(); h++){
-				if(!mark[h] && dist[h] < te){
-					te = dist[h];
-					minp = h;
-				}
-			}
+	if(rst->Length() < 2){
+		THROW_EXCEPTION(ArithmeticException, "Index<i,j> is invalid...");
+	}
 
-			if(minp == -1) break;
+	return rst;
+}
 
-			//将新的节点插入S集合中
-			mark[minp] = true;
+/*
+基于堆的Dijkstra
+	原来的实现每一轮线性扫描dist寻找最小值O(V)，再对所有顶点调用IsAdjacent，总共O(V^2)次，ListGraph上为O(V^3)
+	使用堆之后：
+		每一轮从堆顶取出dist最小的顶点u，O(log(V))
+		只遍历u真正的邻接顶点（AdjacentCursor），dist变小时在堆中上浮（decrease-key）
+		总的复杂度为O((V + E) * log(V))
+
+	堆中的顶点只会被取出一次：取出时dist已经是最短距离，之后的松弛不会再让它变小（要求权值非负）
+	target >= 0时，target被取出即得到其最短路径，提前结束，其余顶点的dist可能不是最终结果
+*/
+template<typename V, typename E>
+void Graph<V, E>::Dijkstra(int i, DijkstraWorkspace<E>& ws, const E& LIMIT, int target){
+	if((i >= 0) && (i < VCount()) && (target < VCount())){
+		ws._reset(VCount(), LIMIT);
+		ws.m_source = i;
+
+		E zero = E();
+		ws._update(i, zero, -1);
+
+		while(ws.m_heap.Length() > 0){
+			int u = ws._pop();
+			if(u == target){
+				break;
+			}
 
-			//找到下一个点的最短路，更新加入新点的前驱数组
-			for(int h = 0; h < VCount(); h++){
-				if(!mark[h] && IsAdjacent(minp, h)){
-					E e = GetEdge(minp, h);
-					if(dist[minp] + e < dist[h]){
-						dist[h] = dist[minp] + e;
-						path[h] = minp;
-					}
+			E du = ws.m_dist.GetArray()[u];
+			AdjacentCursor<E> c;
+			for(bool ok = FirstAdjacent(u, c); ok; ok = NextAdjacent(c)){
+				E nd = du + *c.weight;
+				if(nd < ws.m_dist.GetArray()[c.to]){
+					ws._update(c.to, nd, u);
 				}
 			}
 		}
-
-		s.Push(j);
-		for(int k = path[j]; k != -1;k = path[k] ){
-			s.Push(k);
-		}
-
-		while(s.Size() > 0){
-			rst.Add(s.Top());
-			s.Pop();
-		}
-
 	}
 	else{
-		THROW_EXCEPTION(InvalidOperationException, "Index<i,j> is invalid...");
+		THROW_EXCEPTION(InvalidParameterException, "index i is invalid...");
 	}
-
-	if(rst.Length() < 2){
-		THROW_EXCEPTION(ArithmeticException, "Index<i,j> is invalid...");
-	}
-
-	return ToArray(rst);
 }
 
 
@@ -787,71 +1282,49 @@ Floyd算法本质是通过中转顶点寻找更短路径
 */
 template<typename V, typename E>
 SharedPointer< Array<int> > Graph<V, E>::Floyd(int x, int y, const E& LIMIT){
-	LinkQueue<int> rst;
+	SharedPointer< Array<int> > rst;
 
 	//检测i，j的合法性
 	if((x >= 0)&& (x < VCount()) && (y >= 0) && (y < VCount())){
-		//定义初始化A(0)矩阵，即邻接矩阵，最短距离矩阵
-		DynamicArray<DynamicArray<E>> dist(VCount());
-		DynamicArray<DynamicArray<E>> path(VCount());
-
-		//DynamicArray默认初始化长度为0,对dist和path进行resize操作
-		for(int k = 0; k < VCount(); k++){
-			dist[k].resize(VCount());
-			path[k].resize(VCount());
-		}
-
-		//path初始化为-1，距离初始化为邻接矩阵
-		for(int i= 0; i < VCount(); i++){
-			for(int j = 0; j < VCount(); j++){
-				path[i][j] = -1;
-				dist[i][j] = IsAdjacent(i, j)? (path[i][j] = j, GetEdge(i, j)): LIMIT;
-			}
-		}
-		
-
-		for(int k = 0; k < VCount(); k++){
-			for(int i = 0; i < VCount(); i++){
-				for(int j = 0; j < VCount(); j++){
-					if((dist[i][j] != LIMIT && dist[i][k] + dist[k][j] < dist[i][j]) ||\
-					 (dist[i][j] == LIMIT && dist[i][k] < LIMIT && dist[k][j] < LIMIT)){
-						dist[i][j] = dist[i][k] + dist[k][j];
-						path[i][j] = path[i][k];
-					}
-				}
-			}
-		}
-		
-		//将最小path放到队列中,退出条件，没有路继续走，或者到达终点
-		while(x != -1 && x != y){
-			//将x更新为x到y的路径上，第一个到达的点，不断迭代，找到x
-
-			rst.Add(x);
-			x = path[x][y];
-		}
-
-		//如果到达终点，将终点加入到队列中
-		if(x == y){
-			rst.Add(x);
-		}
-		// for(int i = 0; i < VCount(); i++){
-		// 	for(int j = 0; j < VCount(); j++){
-		// 		cout<<dist[i][j]<<" ";
-		// 	}
-		// 	cout<<endl;
-		// }
-
+		FloydResult<E> fr;
+		Floyd(fr, LIMIT);
+		rst = fr.PathTo(x, y);
 	}
 	else{
 		THROW_EXCEPTION(InvalidOperationException, "Index<i,j> is invalid...");
 	}
-cout<<rst.Length()<<endl;
+
 	//长度小于2，不构成边，即没有最小路径
-	if(rst.Length() < 2){
+	if(rst->Length() < 2){
 		THROW_EXCEPTION(ArithmeticException, "Index<i,j> is invalid...");
 	}
 
-	return ToArray(rst);
+	return rst;
+}
+
+/*
+dist初始化为邻接矩阵：通过AdjacentCursor只访问存在的边，O(n + e)次虚函数调用，而不是n^2次IsAdjacent
+*/
+template<typename V, typename E>
+void Graph<V, E>::Floyd(FloydResult<E>& rst, const E& LIMIT){
+	const int n = VCount();
+	rst._reset(n, LIMIT);
+
+	E* dist = rst.m_dist.GetArray();
+	int* next = rst.m_next.GetArray();
+	AdjacentCursor<E> c;
+	for(int i = 0; i < n; i++){
+		for(bool ok = FirstAdjacent(i, c); ok; ok = NextAdjacent(c)){
+			dist[i * n + c.to] = *c.weight;
+			next[i * n + c.to] = c.to;
+		}
+	}
+	for(int i = 0; i < n; i++){
+		dist[i * n + i] = E();
+		next[i * n + i] = i;
+	}
+
+	rst._solve();
 }
 
 /*
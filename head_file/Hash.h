@@ -0,0 +1,41 @@
+#ifndef __HASH_H__
+#define __HASH_H__
+
+#include "Object.h"
+
+/*
+字节串哈希函数（wyhash）
+	String作为哈希表的键时，哈希函数的速度和质量决定了哈希表的性能
+	逐个字节乘31累加（h = h * 31 + c）每个字节都要一次乘法，并且低位分布很差
+
+	wyhash每次处理8~48个字节，核心是64位 * 64位 = 128位的乘法，将高64位与低64位异或（mum）
+		len <= 16		读入首尾的重叠部分，不需要循环，短串只需要两次mum
+		len > 48		三路并行，每次处理48个字节
+		其他			每次处理16个字节
+	wyhash通过了SMHasher的测试，长串的速度接近内存带宽
+
+	哈希值只与内容有关，String、StringView内容相同时哈希值相同
+	哈希值可能为0（String用0表示还没有计算，为0时每次重新计算，结果依旧正确）
+*/
+
+namespace YzcLib{
+
+class Hash: public Object{
+protected:
+	static unsigned long long _mix(unsigned long long a, unsigned long long b);
+	static void _mum(unsigned long long& a, unsigned long long& b);
+	static unsigned long long _read8(const unsigned char* p);
+	static unsigned long long _read4(const unsigned char* p);
+public:
+	static unsigned long long Bytes(const char* s, unsigned int len, unsigned long long seed = 0);
+};
+
+}
+
+/*
+Test code
+	cout<<Hash::Bytes("hello", 5)<<endl;
+	cout<<(Hash::Bytes("hello", 5) == String("hello").Hash())<<endl;	//1
+*/
+
+#endif
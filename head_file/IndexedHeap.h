@@ -0,0 +1,294 @@
+#ifndef __INDEXEDHEAP_H__
+#define __INDEXEDHEAP_H__
+
+#include "Object.h"
+#include "DynamicArray.h"
+#include "Exception.h"
+//Less, Greater
+#include "PriorityQueue.h"
+
+/*
+索引堆（IndexedHeap）
+	PriorityQueue中的元素没有编号，元素的优先级改变之后无法找到它在堆中的位置
+	Dijkstra、Prim中元素是顶点编号0 ~ n-1，每个顶点的键值（距离）会不断变小
+
+	IndexedHeap中每个元素是一个编号id（[0, n)）和它的键值key：
+		m_heap[k]	堆中第k个位置的id
+		m_pos[id]	id在堆中的位置，不在堆中为-1
+		m_key[id]	id的键值
+	通过m_pos可以在O(1)内找到id，修改键值后上浮或下沉：
+		DecreaseKey(id, key)	键值的优先级变高（Less时变小），上浮，O(log_D(n))
+		Update(id, key)			任意修改，上浮或下沉
+		Remove(id)				删除任意元素
+
+	同一个id在堆中最多出现一次，不需要像PriorityQueue那样插入重复的元素再在出队时跳过（lazy deletion）
+	堆的大小不超过n，空间是确定的
+
+	Clear()只重置堆中剩余的id，O(Length())，反复使用时不需要O(n)的初始化
+	Compare与PriorityQueue相同，Compare(a, b)为true表示a先出堆
+*/
+
+namespace YzcLib{
+
+template<typename K, typename Compare = Less<K>, unsigned int D = 4>
+class IndexedHeap: public Object{
+protected:
+	DynamicArray<int> m_heap;
+	DynamicArray<int> m_pos;
+	DynamicArray<K> m_key;
+	int m_length;
+	Compare m_cmp;
+
+	void _up(int k);
+	void _down(int k);
+	void _check(int id) const;
+public:
+	//id的取值范围为[0, n)
+	IndexedHeap(int n = 0, const Compare& cmp = Compare());
+
+	//扩大id的取值范围，已有的内容保持不变
+	void Resize(int n);
+	int Capacity() const;
+
+	bool Contains(int id) const;
+	K Key(int id) const;
+
+	//id不在堆中时插入，已在堆中时抛出异常
+	void Push(int id, const K& key);
+	//id的键值变为key，key的优先级不能低于原来的键值
+	void DecreaseKey(int id, const K& key);
+	//不在堆中时插入，在堆中时修改键值
+	void Update(int id, const K& key);
+	void Remove(int id);
+
+	//优先级最高的id
+	int Top() const;
+	K TopKey() const;
+	//删除并返回优先级最高的id
+	int Pop();
+
+	int Length() const;
+	void Clear();
+};
+
+template<typename K, typename Compare, unsigned int D>
+IndexedHeap<K, Compare, D>::IndexedHeap(int n, const Compare& cmp): m_cmp(cmp){
+	m_length = 0;
+	Resize(n);
+}
+
+template<typename K, typename Compare, unsigned int D>
+void IndexedHeap<K, Compare, D>::Resize(int n){
+	int old = m_pos.Length();
+	if(n > old){
+		m_heap.resize(n);
+		m_pos.resize(n);
+		m_key.resize(n);
+
+		for(int id = old; id < n; id++){
+			m_pos.GetArray()[id] = -1;
+		}
+	}
+}
+
+template<typename K, typename Compare, unsigned int D>
+int IndexedHeap<K, Compare, D>::Capacity() const{
+	return m_pos.Length();
+}
+
+template<typename K, typename Compare, unsigned int D>
+void IndexedHeap<K, Compare, D>::_check(int id) const{
+	if(!((id >= 0) && (id < Capacity()))){
+		THROW_EXCEPTION(IndexOutOfBoundsException, "Parameter id is invalid ...");
+	}
+}
+
+template<typename K, typename Compare, unsigned int D>
+void IndexedHeap<K, Compare, D>::_up(int k){
+	int* heap = m_heap.GetArray();
+	int* pos = m_pos.GetArray();
+	const K* key = m_key.GetArray();
+	int id = heap[k];
+
+	while(k > 0){
+		int p = (k - 1) / D;
+		if(!m_cmp(key[id], key[heap[p]])){
+			break;
+		}
+		heap[k] = heap[p];
+		pos[heap[k]] = k;
+		k = p;
+	}
+	heap[k] = id;
+	pos[id] = k;
+}
+
+template<typename K, typename Compare, unsigned int D>
+void IndexedHeap<K, Compare, D>::_down(int k){
+	int* heap = m_heap.GetArray();
+	int* pos = m_pos.GetArray();
+	const K* key = m_key.GetArray();
+	int id = heap[k];
+
+	while(true){
+		int c = k * D + 1;
+		if(c >= m_length){
+			break;
+		}
+
+		int end = (c + static_cast<int>(D) < m_length) ? c + D : m_length;
+		int m = c;
+		for(int t = c + 1; t < end; t++){
+			if(m_cmp(key[heap[t]], key[heap[m]])){
+				m = t;
+			}
+		}
+
+		if(!m_cmp(key[heap[m]], key[id])){
+			break;
+		}
+		heap[k] = heap[m];
+		pos[heap[k]] = k;
+		k = m;
+	}
+	heap[k] = id;
+	pos[id] = k;
+}
+
+template<typename K, typename Compare, unsigned int D>
+bool IndexedHeap<K, Compare, D>::Contains(int id) const{
+	return (id >= 0) && (id < Capacity()) && (m_pos.GetArray()[id] >= 0);
+}
+
+template<typename K, typename Compare, unsigned int D>
+K IndexedHeap<K, Compare, D>::Key(int id) const{
+	if(!Contains(id)){
+		THROW_EXCEPTION(InvalidParameterException, "Id is not in current heap ...");
+	}
+	return m_key.GetArray()[id];
+}
+
+template<typename K, typename Compare, unsigned int D>
+void IndexedHeap<K, Compare, D>::Push(int id, const K& key){
+	_check(id);
+	if(m_pos.GetArray()[id] >= 0){
+		THROW_EXCEPTION(InvalidOperationException, "Id is already in current heap ...");
+	}
+
+	m_key.GetArray()[id] = key;
+	m_heap.GetArray()[m_length] = id;
+	m_pos.GetArray()[id] = m_length;
+	m_length++;
+	_up(m_length - 1);
+}
+
+template<typename K, typename Compare, unsigned int D>
+void IndexedHeap<K, Compare, D>::DecreaseKey(int id, const K& key){
+	if(!Contains(id)){
+		THROW_EXCEPTION(InvalidParameterException, "Id is not in current heap ...");
+	}
+	if(m_cmp(m_key.GetArray()[id], key)){
+		THROW_EXCEPTION(InvalidParameterException, "New key has lower priority ...");
+	}
+
+	m_key.GetArray()[id] = key;
+	_up(m_pos.GetArray()[id]);
+}
+
+template<typename K, typename Compare, unsigned int D>
+void IndexedHeap<K, Compare, D>::Update(int id, const K& key){
+	_check(id);
+	int k = m_pos.GetArray()[id];
+	if(k < 0){
+		Push(id, key);
+	}
+	else{
+		//优先级变高上浮，否则下沉
+		bool up = m_cmp(key, m_key.GetArray()[id]);
+		m_key.GetArray()[id] = key;
+		up ? _up(k) : _down(k);
+	}
+}
+
+template<typename K, typename Compare, unsigned int D>
+void IndexedHeap<K, Compare, D>::Remove(int id){
+	if(!Contains(id)){
+		THROW_EXCEPTION(InvalidParameterException, "Id is not in current heap ...");
+	}
+
+	int* heap = m_heap.GetArray();
+	int k = m_pos.GetArray()[id];
+	m_pos.GetArray()[id] = -1;
+	m_length--;
+
+	//尾部元素填到k，可能需要上浮，也可能需要下沉
+	if(k < m_length){
+		int last = heap[m_length];
+		heap[k] = last;
+		m_pos.GetArray()[last] = k;
+		_up(k);
+		_down(m_pos.GetArray()[last]);
+	}
+}
+
+template<typename K, typename Compare, unsigned int D>
+int IndexedHeap<K, Compare, D>::Top() const{
+	if(m_length > 0){
+		return m_heap.GetArray()[0];
+	}
+	else{
+		THROW_EXCEPTION(InvalidOperationException, "No element in current heap ... ");
+	}
+}
+
+template<typename K, typename Compare, unsigned int D>
+K IndexedHeap<K, Compare, D>::TopKey() const{
+	return m_key.GetArray()[Top()];
+}
+
+template<typename K, typename Compare, unsigned int D>
+int IndexedHeap<K, Compare, D>::Pop(){
+	int rst = Top();
+	int* heap = m_heap.GetArray();
+
+	m_pos.GetArray()[rst] = -1;
+	m_length--;
+	if(m_length > 0){
+		heap[0] = heap[m_length];
+		_down(0);
+	}
+	return rst;
+}
+
+template<typename K, typename Compare, unsigned int D>
+int IndexedHeap<K, Compare, D>::Length() const{
+	return m_length;
+}
+
+template<typename K, typename Compare, unsigned int D>
+void IndexedHeap<K, Compare, D>::Clear(){
+	const int* heap = m_heap.GetArray();
+	for(int k = 0; k < m_length; k++){
+		m_pos.GetArray()[heap[k]] = -1;
+	}
+	m_length = 0;
+}
+
+}
+
+/*
+Test code
+	IndexedHeap<int> h(5);
+	h.Push(0, 50);
+	h.Push(3, 30);
+	h.Push(4, 40);
+	h.DecreaseKey(0, 10);
+	h.Update(3, 60);
+
+	while(h.Length() > 0){
+		cout<<h.TopKey()<<" ";
+		cout<<h.Pop()<<endl;		//10 0, 40 4, 60 3
+	}
+*/
+
+#endif
@@ -2,7 +2,9 @@
 #define __LINKLIST_H__
 
 #include "List.h"
+//ostream
 #include <iostream>
+using namespace std;
 
 /*
 链表:
@@ -113,6 +115,14 @@ public:
 	virtual T Current();//获取游标所指向的数据元素
 	virtual bool End();//游标是否到达尾部（是否为空）
 
+	//位置（Position）：只读的遍历，不修改链表内部的游标，可以在const函数中使用，多个遍历可以同时进行
+	//Value返回引用，不拷贝数据元素；链表被修改（Remove、Clear）之后位置失效
+	//Following、Value只与节点有关，是静态函数，只保存位置也可以继续遍历
+	typedef const Node* Position;
+	Position First() const;//第一个数据节点，空链表为NULL
+	static Position Following(Position p);//p的下一个节点，p为最后一个节点时为NULL
+	static const T& Value(Position p);
+
 	//输出函数
 	//友元函数不加作用域限制，本身就是类外部的函数，不需要传递this指针
 	//打印效果 Head -> 0 -> 1 -> 2 -> 3 -> 4 -> NULL
@@ -368,6 +378,24 @@ T LinkList<T>:: Current(){
 
 
 
+template<typename T>
+typename LinkList<T>::Position LinkList<T>::First() const{
+	return head.next;
+}
+
+template<typename T>
+typename LinkList<T>::Position LinkList<T>::Following(Position p){
+	return (p != NULL) ? p->next : NULL;
+}
+
+template<typename T>
+const T& LinkList<T>::Value(Position p){
+	if(p == NULL){
+		THROW_EXCEPTION(InvalidOperationException, "No value at current position...");
+	}
+	return p->value;
+}
+
 template<typename T>
 LinkList<T>::~LinkList(){
 	Clear();
@@ -64,6 +64,8 @@ public:
 	bool IsAdjacent(int i, int j);
 
 	SharedPointer<Array<int>> GetAdjacent(int i);
+	bool FirstAdjacent(int i, AdjacentCursor<E>& c);
+	bool NextAdjacent(AdjacentCursor<E>& c);
 
 	E GetEdge(int i, int j);
 	bool GetEdge(int i, int j, E& value);
@@ -217,6 +219,7 @@ void ListGraph<V, E>::RemoveVertex(){
 					m_list.Current()->edge.Remove(index);
 				}
 			}
+			this->_invalidate();
 			delete v->data;
 			delete v;
 		}
@@ -259,6 +262,35 @@ SharedPointer<Array<int>> ListGraph<V, E>::GetAdjacent(int i){
 	return rst;
 }
 
+/*
+游标保存边链表中的位置（LinkList::Position），沿着链表向后移动，不拷贝边、不申请空间
+只有FirstAdjacent需要在顶点链表中找到顶点i，NextAdjacent只使用保存的位置
+*/
+template<typename V, typename E>
+bool ListGraph<V, E>::FirstAdjacent(int i, AdjacentCursor<E>& c){
+	if(!CHECKBOUND(i)){
+		THROW_EXCEPTION(InvalidOperationException, "Index i is invalid...");
+	}
+	typename LinkList<Edge<E> >::Position p = m_list.Get(i)->edge.First();
+	c.from = i;
+	c.pos = 0;
+	c.node = p;
+	c.to = (p != NULL) ? LinkList<Edge<E> >::Value(p).e : -1;
+	c.weight = (p != NULL) ? &LinkList<Edge<E> >::Value(p).data : NULL;
+	return c.to >= 0;
+}
+
+template<typename V, typename E>
+bool ListGraph<V, E>::NextAdjacent(AdjacentCursor<E>& c){
+	typename LinkList<Edge<E> >::Position p = static_cast<typename LinkList<Edge<E> >::Position>(c.node);
+	p = LinkList<Edge<E> >::Following(p);
+	c.pos++;
+	c.node = p;
+	c.to = (p != NULL) ? LinkList<Edge<E> >::Value(p).e : -1;
+	c.weight = (p != NULL) ? &LinkList<Edge<E> >::Value(p).data : NULL;
+	return c.to >= 0;
+}
+
 template<typename V, typename E>
 E ListGraph<V, E>::GetEdge(int i, int j){
 	E rst;
@@ -304,6 +336,7 @@ bool ListGraph<V, E>:: SetEdge(int i, int j, const E& value){
 			//与vertex不同，edge没有编号，因此在最前边插入，效率高
 			rst = v->edge.Insert(0, Edge<E>(i, j, value));
 		}
+		this->_invalidate();
 	}
 	return rst;
 }
@@ -324,6 +357,7 @@ bool ListGraph<V, E>:: RemoveEdge(int i, int j){
 		*/
 		if(loc >= 0){
 			rst = v->edge.Remove(loc);
+			this->_invalidate();
 		}
 	}
 
@@ -0,0 +1,223 @@
+#ifndef __LOSERTREE_H__
+#define __LOSERTREE_H__
+
+#include "Object.h"
+#include "Exception.h"
+#include "DynamicArray.h"
+
+/*
+败者树（Loser Tree）
+	多路归并时，每次都要从k路的当前元素中选出最小（或最大）的元素
+	若每次都顺序比较k路，则每输出一个元素需要 k - 1 次比较
+	败者树是一棵完全二叉树，叶子为k路的当前元素，内部节点记录“比赛”的败者，根节点之上额外记录胜者
+	当胜者所在的路输出一个元素后，只需要沿该叶子到根的路径重新比赛一次，比较次数为 ceil(log(k))
+
+	k路叶子		key[0], key[1], ..., key[k - 1]
+	内部节点	tree[1], ..., tree[k - 1]	存放败者所在路的编号
+	胜者		tree[0]
+
+	叶子s的父节点为 (s + k) / 2, 内部节点t的父节点为 t / 2
+
+与胜者树相比：
+	胜者树重新比赛时需要与兄弟节点比较，需要访问兄弟
+	败者树重新比赛时只需要与父节点记录的败者比较，路径更短，访问更规则
+
+稳定性：
+	当两路元素相等时，编号小的路获胜，因此按路的编号顺序给出的有序序列，归并结果是稳定的
+
+耗尽的路视为无穷大（或无穷小），任何未耗尽的路都可以战胜它
+当胜者所在的路也耗尽时，说明全部的路都已经耗尽
+*/
+
+namespace YzcLib{
+
+template<typename T>
+class LoserTree: public Object{
+protected:
+	DynamicArray<int> m_tree;	//内部节点记录败者，m_tree[0]记录胜者
+	DynamicArray<T> m_key;		//每一路的当前元素
+	DynamicArray<bool> m_end;	//每一路是否已经耗尽
+	unsigned int m_k;
+	bool m_model;
+
+	//a路是否战胜b路，-1是构建时的占位，能战胜任何一路
+	bool _win(int a, int b) const;
+	//叶子s的元素发生变化，沿路径向上重新比赛
+	void _adjust(int s);
+public:
+	//k为归并的路数，model与Sort一致，true为升序，false为降序
+	LoserTree(unsigned int k, bool model = true);
+
+	//构建之前设置第i路的当前元素
+	void Set(unsigned int i, const T& e);
+	//构建之前标记第i路已经耗尽（空的序列）
+	void Exhaust(unsigned int i);
+	//根据每一路的当前元素构建败者树
+	void Build();
+
+	//胜者所在的路，全部耗尽返回-1
+	int Winner() const;
+	//胜者的元素
+	const T& Top() const;
+	//胜者路读入下一个元素，重新比赛
+	void Replace(const T& e);
+	//胜者路已经耗尽，重新比赛
+	void Pop();
+
+	unsigned int Ways() const;
+};
+
+template<typename T>
+LoserTree<T>::LoserTree(unsigned int k, bool model):m_tree(k), m_key(k), m_end(k){
+	if(k == 0){
+		THROW_EXCEPTION(InvalidParameterException, "LoserTree needs at least one way...");
+	}
+	m_k = k;
+	m_model = model;
+	for(unsigned int i = 0; i < k; i++){
+		m_tree[i] = -1;
+		m_end[i] = true;
+	}
+}
+
+template<typename T>
+bool LoserTree<T>::_win(int a, int b) const{
+	bool rst = false;
+	if(a == -1){
+		rst = true;
+	}
+	else if(b == -1){
+		rst = false;
+	}
+	else if(m_end[a] || m_end[b]){
+		//耗尽的路是无穷大，两路都耗尽时编号小的获胜，保证结果确定
+		rst = m_end[b] && (!m_end[a] || a < b);
+	}
+	else{
+		const T& ka = m_key.GetArray()[a];
+		const T& kb = m_key.GetArray()[b];
+		if(m_model ? (ka < kb) : (ka > kb)){
+			rst = true;
+		}
+		else if(m_model ? (kb < ka) : (kb > ka)){
+			rst = false;
+		}
+		else{
+			//相等时编号小的获胜，保证归并的稳定性
+			rst = (a < b);
+		}
+	}
+	return rst;
+}
+
+template<typename T>
+void LoserTree<T>::_adjust(int s){
+	int* tree = m_tree.GetArray();
+	//t为叶子s的父节点
+	for(unsigned int t = (s + m_k) / 2; t > 0; t /= 2){
+		//父节点中的败者能够战胜s，则s成为败者留在此处，原来的败者继续向上比赛
+		if(_win(tree[t], s)){
+			int temp = tree[t];
+			tree[t] = s;
+			s = temp;
+		}
+	}
+	tree[0] = s;
+}
+
+template<typename T>
+void LoserTree<T>::Set(unsigned int i, const T& e){
+	if(i < m_k){
+		m_key[i] = e;
+		m_end[i] = false;
+	}
+	else{
+		THROW_EXCEPTION(IndexOutOfBoundsException, "Parameter i is invalid...");
+	}
+}
+
+template<typename T>
+void LoserTree<T>::Exhaust(unsigned int i){
+	if(i < m_k){
+		m_end[i] = true;
+	}
+	else{
+		THROW_EXCEPTION(IndexOutOfBoundsException, "Parameter i is invalid...");
+	}
+}
+
+/*
+内部节点先全部置为占位符-1（能战胜任何一路）
+从最后一路开始逐路比赛，每一路比赛后占位符会被逐个替换掉
+全部比赛结束后，所有内部节点都记录的是真实的败者
+*/
+template<typename T>
+void LoserTree<T>::Build(){
+	for(unsigned int i = 0; i < m_k; i++){
+		m_tree[i] = -1;
+	}
+	for(int s = m_k - 1; s >= 0; s--){
+		_adjust(s);
+	}
+}
+
+template<typename T>
+int LoserTree<T>::Winner() const{
+	int w = m_tree.GetArray()[0];
+	return ((w >= 0) && !m_end.GetArray()[w]) ? w : -1;
+}
+
+template<typename T>
+const T& LoserTree<T>::Top() const{
+	int w = Winner();
+	if(w < 0){
+		THROW_EXCEPTION(InvalidOperationException, "All ways of LoserTree are exhausted...");
+	}
+	return m_key.GetArray()[w];
+}
+
+template<typename T>
+void LoserTree<T>::Replace(const T& e){
+	int w = Winner();
+	if(w < 0){
+		THROW_EXCEPTION(InvalidOperationException, "All ways of LoserTree are exhausted...");
+	}
+	m_key[w] = e;
+	_adjust(w);
+}
+
+template<typename T>
+void LoserTree<T>::Pop(){
+	int w = Winner();
+	if(w < 0){
+		THROW_EXCEPTION(InvalidOperationException, "All ways of LoserTree are exhausted...");
+	}
+	m_end[w] = true;
+	_adjust(w);
+}
+
+template<typename T>
+unsigned int LoserTree<T>::Ways() const{
+	return m_k;
+}
+
+/*
+Test code
+	LoserTree<int> lt(3);
+	lt.Set(0, 5);
+	lt.Set(1, 1);
+	lt.Exhaust(2);
+	lt.Build();
+
+	cout<<lt.Winner()<<" : "<<lt.Top()<<endl;	//1 : 1
+	lt.Replace(9);
+	cout<<lt.Winner()<<" : "<<lt.Top()<<endl;	//0 : 5
+	lt.Pop();
+	cout<<lt.Winner()<<" : "<<lt.Top()<<endl;	//1 : 9
+	lt.Pop();
+	cout<<lt.Winner()<<endl;					//-1
+*/
+
+}
+
+#endif
@@ -69,6 +69,8 @@ public:
 	bool SetVertex(int i, const V& value);
 	
 	SharedPointer<Array<int>> GetAdjacent(int i);
+	bool FirstAdjacent(int i, AdjacentCursor<E>& c);
+	bool NextAdjacent(AdjacentCursor<E>& c);
 
 	E GetEdge(int i, int j);
 	bool GetEdge(int i, int j, E& value);
@@ -188,6 +190,33 @@ SharedPointer<Array<int>> MatrixGraph<N, V, E>::GetAdjacent(int i){
 	return rst;
 }
 
+/*
+游标从第i行的第pos列开始向后寻找下一个不为NULL的边，一行只扫描一遍，不申请空间
+*/
+template<int N, typename V, typename E>
+bool MatrixGraph<N, V, E>::FirstAdjacent(int i, AdjacentCursor<E>& c){
+	if(!CHECKBOUND(i)){
+		THROW_EXCEPTION(InvalidParameterException , "Paranmeter  i is not of range");
+	}
+	c.from = i;
+	c.pos = -1;
+	return NextAdjacent(c);
+}
+
+template<int N, typename V, typename E>
+bool MatrixGraph<N, V, E>::NextAdjacent(AdjacentCursor<E>& c){
+	E* const* row = m_edges[c.from];
+	int j = c.pos + 1;
+	while((j < N) && (row[j] == NULL)){
+		j++;
+	}
+
+	c.pos = j;
+	c.to = (j < N) ? j : -1;
+	c.weight = (j < N) ? row[j] : NULL;
+	return c.to >= 0;
+}
+
 template<int N, typename V, typename E>
 E MatrixGraph<N, V, E>::GetEdge(int i, int j){
 	E rst;
@@ -227,6 +256,7 @@ bool MatrixGraph<N, V, E>:: SetEdge(int i, int j, const E& value){
 			*temp = value;
 			(m_edges[i][j] == NULL) && (m_ecount++);
 			m_edges[i][j] = temp;
+			this->_invalidate();
 		}
 		else{
 			THROW_EXCEPTION(InvalidParameterException, "No memory to store new edge value...");
@@ -250,6 +280,7 @@ bool MatrixGraph<N, V, E>:: RemoveEdge(int i, int j){
 		if(toDel != NULL){
 
 			m_ecount--;
+			this->_invalidate();
 			delete toDel;
 		}
 
@@ -0,0 +1,277 @@
+#ifndef __PAIRINGHEAP_H__
+#define __PAIRINGHEAP_H__
+
+#include "Object.h"
+#include "Exception.h"
+//Less, Greater
+#include "PriorityQueue.h"
+
+/*
+配对堆（Pairing Heap）
+	一种基于多叉树的堆，结构非常简单：
+		Merge(a, b)		根的优先级低的一棵成为另一棵根的第一个孩子，O(1)
+		Push			一个结点的堆与原来的堆Merge，O(1)
+		DecreaseKey		将结点连同子树从树中剪下，再与根Merge，均摊o(log(n))
+		Pop				删除根，孩子从左到右两两Merge，再从右到左依次Merge（two-pass），均摊O(log(n))
+
+	结点使用左孩子-右兄弟表示：
+		child	第一个孩子
+		next	右边的兄弟
+		prev	第一个孩子指向父结点，其他结点指向左边的兄弟（剪下子树时需要）
+
+与d叉堆（PriorityQueue、IndexedHeap）相比：
+	Push、DecreaseKey、两个堆的合并更快，理论上适合DecreaseKey非常多的场合
+	每个元素都是一个单独申请的结点，Pop需要沿着指针访问，缓存命中率低，实际中一般慢于4叉堆
+	用于比较测试，以及需要频繁合并两个堆的场合
+
+	Push返回结点的句柄（Handle），DecreaseKey通过句柄找到结点，句柄在元素出堆之前一直有效
+	PairingHeap禁止拷贝：每个结点都属于这个堆，句柄直接指向结点，拷贝后句柄无法对应到新的堆中
+*/
+
+namespace YzcLib{
+
+template<typename T, typename Compare = Less<T> >
+class PairingHeap: public Object{
+protected:
+	struct Node: public Object{
+		T value;
+		Node* child;
+		Node* next;
+		Node* prev;
+	};
+
+	Node* m_root;
+	unsigned int m_length;
+	Compare m_cmp;
+
+	Node* _merge(Node* a, Node* b);
+	//将孩子链表两两合并，返回新的根
+	Node* _combine(Node* first);
+	void _destroy(Node* n);
+
+	PairingHeap(const PairingHeap&);
+	PairingHeap& operator = (const PairingHeap&);
+public:
+	typedef Node* Handle;
+
+	PairingHeap(const Compare& cmp = Compare());
+
+	Handle Push(const T& e);
+	void Pop();
+	T Top() const;
+	//h的值变为e，e的优先级不能低于原来的值
+	void DecreaseKey(Handle h, const T& e);
+	//将h中的元素全部移动到当前的堆中，h变为空，O(1)
+	void Merge(PairingHeap& h);
+
+	unsigned int Length() const;
+	void Clear();
+
+	~PairingHeap();
+};
+
+template<typename T, typename Compare>
+PairingHeap<T, Compare>::PairingHeap(const Compare& cmp): m_cmp(cmp){
+	m_root = NULL;
+	m_length = 0;
+}
+
+template<typename T, typename Compare>
+typename PairingHeap<T, Compare>::Node* PairingHeap<T, Compare>::_merge(Node* a, Node* b){
+	Node* rst = NULL;
+	if(a == NULL){
+		rst = b;
+	}
+	else if(b == NULL){
+		rst = a;
+	}
+	else{
+		//保证a的优先级不低于b，b成为a的第一个孩子
+		if(m_cmp(b->value, a->value)){
+			Node* t = a;
+			a = b;
+			b = t;
+		}
+
+		b->prev = a;
+		b->next = a->child;
+		if(a->child != NULL){
+			a->child->prev = b;
+		}
+		a->child = b;
+		a->next = NULL;
+		a->prev = NULL;
+		rst = a;
+	}
+	return rst;
+}
+
+/*
+two-pass：
+	1.从左到右，相邻的两个子树合并，结果通过next串成一个逆序的链表
+	2.从右到左，依次合并到一起
+不使用递归，孩子很多时不会栈溢出
+*/
+template<typename T, typename Compare>
+typename PairingHeap<T, Compare>::Node* PairingHeap<T, Compare>::_combine(Node* first){
+	Node* pairs = NULL;
+
+	while(first != NULL){
+		Node* a = first;
+		Node* b = a->next;
+		first = b ? b->next : NULL;
+
+		a->next = NULL;
+		a->prev = NULL;
+		if(b != NULL){
+			b->next = NULL;
+			b->prev = NULL;
+		}
+
+		Node* m = _merge(a, b);
+		m->next = pairs;
+		pairs = m;
+	}
+
+	Node* rst = NULL;
+	while(pairs != NULL){
+		Node* n = pairs;
+		pairs = pairs->next;
+		n->next = NULL;
+		rst = _merge(rst, n);
+	}
+	return rst;
+}
+
+template<typename T, typename Compare>
+typename PairingHeap<T, Compare>::Handle PairingHeap<T, Compare>::Push(const T& e){
+	Node* n = new Node();
+	if(n == NULL){
+		THROW_EXCEPTION(NotEnoughMemoryException, "No memory to create PairingHeap node ...");
+	}
+	n->value = e;
+	n->child = NULL;
+	n->next = NULL;
+	n->prev = NULL;
+
+	m_root = _merge(m_root, n);
+	m_length++;
+	return n;
+}
+
+template<typename T, typename Compare>
+void PairingHeap<T, Compare>::Pop(){
+	if(m_root != NULL){
+		Node* toDel = m_root;
+		m_root = _combine(m_root->child);
+		m_length--;
+		delete toDel;
+	}
+	else{
+		THROW_EXCEPTION(InvalidOperationException, "No element in current heap ... ");
+	}
+}
+
+template<typename T, typename Compare>
+T PairingHeap<T, Compare>::Top() const{
+	if(m_root != NULL){
+		return m_root->value;
+	}
+	else{
+		THROW_EXCEPTION(InvalidOperationException, "No element in current heap ... ");
+	}
+}
+
+template<typename T, typename Compare>
+void PairingHeap<T, Compare>::DecreaseKey(Handle h, const T& e){
+	if(h == NULL){
+		THROW_EXCEPTION(InvalidParameterException, "Handle can not be NULL ...");
+	}
+	if(m_cmp(h->value, e)){
+		THROW_EXCEPTION(InvalidParameterException, "New value has lower priority ...");
+	}
+
+	h->value = e;
+	if(h != m_root){
+		//从父结点的孩子链表（或者兄弟链表）中剪下h，再与根合并
+		if(h->prev->child == h){
+			h->prev->child = h->next;
+		}
+		else{
+			h->prev->next = h->next;
+		}
+		if(h->next != NULL){
+			h->next->prev = h->prev;
+		}
+		h->next = NULL;
+		h->prev = NULL;
+
+		m_root = _merge(m_root, h);
+	}
+}
+
+template<typename T, typename Compare>
+void PairingHeap<T, Compare>::Merge(PairingHeap& h){
+	if(this != &h){
+		m_root = _merge(m_root, h.m_root);
+		m_length += h.m_length;
+		h.m_root = NULL;
+		h.m_length = 0;
+	}
+}
+
+template<typename T, typename Compare>
+unsigned int PairingHeap<T, Compare>::Length() const{
+	return m_length;
+}
+
+//沿着孩子和兄弟逐个删除，借助next把待删除的子树串起来，不使用递归
+template<typename T, typename Compare>
+void PairingHeap<T, Compare>::_destroy(Node* n){
+	while(n != NULL){
+		if(n->child != NULL){
+			//把孩子链表接到n的兄弟之前
+			Node* last = n->child;
+			while(last->next != NULL){
+				last = last->next;
+			}
+			last->next = n->next;
+			n->next = n->child;
+			n->child = NULL;
+		}
+		Node* toDel = n;
+		n = n->next;
+		delete toDel;
+	}
+}
+
+template<typename T, typename Compare>
+void PairingHeap<T, Compare>::Clear(){
+	Node* root = m_root;
+	m_root = NULL;
+	m_length = 0;
+	_destroy(root);
+}
+
+template<typename T, typename Compare>
+PairingHeap<T, Compare>::~PairingHeap(){
+	Clear();
+}
+
+}
+
+/*
+Test code
+	PairingHeap<int> h;
+	PairingHeap<int>::Handle a = h.Push(50);
+	h.Push(20);
+	h.Push(30);
+	h.DecreaseKey(a, 10);
+
+	while(h.Length() > 0){
+		cout<<h.Top()<<endl;		//10, 20, 30
+		h.Pop();
+	}
+*/
+
+#endif
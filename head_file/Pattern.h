@@ -0,0 +1,99 @@
+#ifndef __PATTERN_H__
+#define __PATTERN_H__
+
+#include "Object.h"
+#include "String.h"
+#include "StringView.h"
+#include "StringSearch.h"
+
+/*
+预编译的查找模式（Pattern）
+	同一个子串在大量的字符串中查找时（例如对每一行日志查找同一个关键字），
+	String::IndexOf每次都要重新分析子串（KMP的部分匹配表，Two-Way的分解）
+	Pattern在构造时根据子串长度和CPU选择算法，并且一次性生成算法需要的表，之后可以在任意多个字符串中查找
+
+	算法的选择（AUTO）：
+		pl == 1						MEMCHR		memchr，c库中已经向量化
+		pl <= SIMD_MAX，支持SIMD	SIMD		首尾字节SIMD过滤（StringSearch），预先计算Two-Way的分解，过滤失效时使用
+		pl <= KMP_MAX，不支持SIMD	KMP			部分匹配表
+		其他（pl较长）				HYBRID		Horspool，验证的代价超过扫描长度的常数倍时改用预先分解的Two-Way，保证O(n + m)
+	HORSPOOL（原始的Horspool，最坏O(n * m)）只在指定时使用，方便测试和比较
+
+Boyer-Moore-Horspool：
+	从右向左比较，每次用窗口最后一个字符c查表决定右移的距离
+		c在p[0, pl - 1)中出现过：右移 pl - 1 - (c在p[0, pl - 1)中最后一次出现的位置)
+		否则：右移pl
+	s -> a b c x a b c d
+	p -> a b c d
+	           窗口最后一个字符为x，x不在p中，右移4
+
+	Pattern p("error");
+	for(...) if(p.Find(line) >= 0) ...
+
+注意：
+	Pattern拥有子串的拷贝，构造之后子串被修改不影响Pattern
+	Pattern禁止拷贝：部分匹配表、坏字符表是new申请的，浅拷贝后两个对象会释放同一张表
+*/
+
+namespace YzcLib{
+
+class Pattern: public Object{
+public:
+	enum Strategy{
+		AUTO,
+		MEMCHR,
+		SIMD,
+		KMP,
+		HORSPOOL,
+		HYBRID
+	};
+protected:
+	String m_pattern;
+	Strategy m_strategy;
+	int* m_pmt;				//KMP的部分匹配表
+	unsigned int* m_skip;	//Horspool的坏字符表
+	StringSearch::Factor m_factor;	//SIMD过滤、HYBRID失效时使用的Two-Way分解
+
+	void _init(const char* p, unsigned int len, Strategy strategy);
+	int _kmp(const char* s, unsigned int sl) const;
+	//bounded为true时，跳跃退化后改用Two-Way
+	int _horspool(const char* s, unsigned int sl, bool bounded) const;
+
+	Pattern(const Pattern&);
+	Pattern& operator = (const Pattern&);
+public:
+	//不支持SIMD时，长度不超过KMP_MAX的子串使用KMP，更长的使用HYBRID
+	//长度超过StringSearch::SIMD_MAX的子串总是使用HYBRID
+	enum{ KMP_MAX = 8 };
+
+	//strategy为AUTO时自动选择，也可以指定算法（方便测试和比较），pl == 1时总是使用MEMCHR
+	Pattern(const char* p, Strategy strategy = AUTO);
+	Pattern(const char* p, unsigned int len, Strategy strategy = AUTO);
+	Pattern(const StringView& p, Strategy strategy = AUTO);
+
+	//在s的前sl个字符中查找，返回第一次出现的位置，找不到（或者子串为空）返回-1
+	int Find(const char* s, unsigned int sl) const;
+	//从start开始查找，返回的位置相对于s的起点
+	int Find(const StringView& s, unsigned int start = 0) const;
+
+	Strategy GetStrategy() const;
+	StringView View() const;
+	unsigned int Length() const;
+
+	~Pattern();
+};
+
+}
+
+/*
+Test code
+	Pattern p("world");
+	String s = "hello world";
+
+	cout<<p.Find(s)<<endl;						//6
+	cout<<p.Find("world peace")<<endl;			//0
+	cout<<p.Find(s, 7)<<endl;					//-1
+	cout<<Pattern("o", Pattern::KMP).GetStrategy()<<endl;	//1 (MEMCHR)
+*/
+
+#endif
@@ -0,0 +1,234 @@
+#ifndef __PRIORITYQUEUE_H__
+#define __PRIORITYQUEUE_H__
+
+#include "Queue.h"
+#include "Array.h"
+#include "DynamicArray.h"
+#include "Exception.h"
+
+/*
+优先队列（PriorityQueue）
+	普通队列先进先出，优先队列每次取出优先级最高的元素
+	Prim、Dijkstra每一轮都要找出最小的元素，线性扫描为O(n)，优先队列为O(log(n))
+
+比较函数（Compare）：
+	Compare(a, b)为true表示a的优先级高于b，a先出队
+		Less<T>		最小的先出队（最小堆），默认
+		Greater<T>	最大的先出队（最大堆）
+	也可以使用任意提供 bool operator()(const T&, const T&) const 的类型
+
+d叉堆（d-ary heap）：
+	堆存放在DynamicArray中，k的孩子为 k * D + 1 ~ k * D + D，父结点为 (k - 1) / D
+	Push	放在尾部，上浮，O(log_D(n))
+	Pop		尾部元素放到堆顶，下沉，每层比较D次，O(D * log_D(n))
+	D = 4时树的高度是二叉堆的一半，上浮更快，一个结点的4个孩子通常在同一个缓存行中，实际测试中一般快于二叉堆
+
+	PriorityQueue(a)	从数组批量建堆（heapify），从最后一个非叶结点开始逐个下沉，O(n)，逐个Push为O(n * log(n))
+
+	PriorityQueue继承Queue<T>，Add/Remove/Front与Push/Pop/Top相同，可以在使用Queue<T>的地方直接替换
+*/
+
+namespace YzcLib{
+
+template<typename T>
+struct Less: public Object{
+	bool operator ()(const T& a, const T& b) const{
+		return a < b;
+	}
+};
+
+template<typename T>
+struct Greater: public Object{
+	bool operator ()(const T& a, const T& b) const{
+		return b < a;
+	}
+};
+
+template<typename T, typename Compare = Less<T>, unsigned int D = 4>
+class PriorityQueue: public Queue<T>{
+protected:
+	DynamicArray<T> m_heap;
+	unsigned int m_length;
+	Compare m_cmp;
+
+	void _up(unsigned int k);
+	void _down(unsigned int k);
+public:
+	//capacity为预留的容量
+	PriorityQueue(unsigned int capacity = 0, const Compare& cmp = Compare());
+	//批量建堆，O(n)
+	PriorityQueue(const Array<T>& a, const Compare& cmp = Compare());
+
+	void Push(const T& e);
+	void Pop();
+	T Top() const;
+
+	void Add(const T& e);
+	void Remove();
+	T Front() const;
+	void Clear();
+	unsigned int Length() const;
+
+	void Reserve(unsigned int capacity);
+};
+
+template<typename T, typename Compare, unsigned int D>
+PriorityQueue<T, Compare, D>::PriorityQueue(unsigned int capacity, const Compare& cmp): m_heap(capacity), m_cmp(cmp){
+	m_length = 0;
+}
+
+template<typename T, typename Compare, unsigned int D>
+PriorityQueue<T, Compare, D>::PriorityQueue(const Array<T>& a, const Compare& cmp): m_heap(a.Length()), m_cmp(cmp){
+	m_length = a.Length();
+
+	T* heap = m_heap.GetArray();
+	for(unsigned int i = 0; i < m_length; i++){
+		heap[i] = a.GetArray()[i];
+	}
+
+	//叶结点本身就是堆，从最后一个非叶结点开始下沉
+	if(m_length > 1){
+		for(unsigned int k = (m_length - 2) / D + 1; k > 0; k--){
+			_down(k - 1);
+		}
+	}
+}
+
+//空出位置，父结点依次下移，最后放入e，每层只赋值一次
+template<typename T, typename Compare, unsigned int D>
+void PriorityQueue<T, Compare, D>::_up(unsigned int k){
+	T* heap = m_heap.GetArray();
+	T e = heap[k];
+
+	while(k > 0){
+		unsigned int p = (k - 1) / D;
+		if(!m_cmp(e, heap[p])){
+			break;
+		}
+		heap[k] = heap[p];
+		k = p;
+	}
+	heap[k] = e;
+}
+
+template<typename T, typename Compare, unsigned int D>
+void PriorityQueue<T, Compare, D>::_down(unsigned int k){
+	T* heap = m_heap.GetArray();
+	T e = heap[k];
+
+	while(true){
+		unsigned int c = k * D + 1;
+		if(c >= m_length){
+			break;
+		}
+
+		//D个孩子中优先级最高的一个
+		unsigned int end = (c + D < m_length) ? c + D : m_length;
+		unsigned int m = c;
+		for(unsigned int t = c + 1; t < end; t++){
+			if(m_cmp(heap[t], heap[m])){
+				m = t;
+			}
+		}
+
+		if(!m_cmp(heap[m], e)){
+			break;
+		}
+		heap[k] = heap[m];
+		k = m;
+	}
+	heap[k] = e;
+}
+
+template<typename T, typename Compare, unsigned int D>
+void PriorityQueue<T, Compare, D>::Push(const T& e){
+	//容量按几何级数增长
+	if(m_length == m_heap.Length()){
+		Reserve(m_length ? m_length * 2 : 16);
+	}
+	m_heap.GetArray()[m_length] = e;
+	m_length++;
+	_up(m_length - 1);
+}
+
+template<typename T, typename Compare, unsigned int D>
+void PriorityQueue<T, Compare, D>::Pop(){
+	if(m_length > 0){
+		m_length--;
+		if(m_length > 0){
+			T* heap = m_heap.GetArray();
+			heap[0] = heap[m_length];
+			_down(0);
+		}
+	}
+	else{
+		THROW_EXCEPTION(InvalidOperationException, "No element in current queue ... ");
+	}
+}
+
+template<typename T, typename Compare, unsigned int D>
+T PriorityQueue<T, Compare, D>::Top() const{
+	if(m_length > 0){
+		return m_heap.GetArray()[0];
+	}
+	else{
+		THROW_EXCEPTION(InvalidOperationException, "No element in current queue ... ");
+	}
+}
+
+template<typename T, typename Compare, unsigned int D>
+void PriorityQueue<T, Compare, D>::Add(const T& e){
+	Push(e);
+}
+
+template<typename T, typename Compare, unsigned int D>
+void PriorityQueue<T, Compare, D>::Remove(){
+	Pop();
+}
+
+template<typename T, typename Compare, unsigned int D>
+T PriorityQueue<T, Compare, D>::Front() const{
+	return Top();
+}
+
+//保留已经申请的空间，方便重复使用
+template<typename T, typename Compare, unsigned int D>
+void PriorityQueue<T, Compare, D>::Clear(){
+	m_length = 0;
+}
+
+template<typename T, typename Compare, unsigned int D>
+unsigned int PriorityQueue<T, Compare, D>::Length() const{
+	return m_length;
+}
+
+template<typename T, typename Compare, unsigned int D>
+void PriorityQueue<T, Compare, D>::Reserve(unsigned int capacity){
+	if(capacity > m_heap.Length()){
+		m_heap.resize(capacity);
+	}
+}
+
+}
+
+/*
+Test code
+	PriorityQueue<int> q;
+	q.Push(5);
+	q.Push(1);
+	q.Push(3);
+	while(q.Length() > 0){
+		cout<<q.Top()<<endl;		//1, 3, 5
+		q.Pop();
+	}
+
+	int a[] = {3, 9, 4, 7};
+	StaticArray<int, 4> sa;
+	for(int i = 0; i < 4; i++){
+		sa[i] = a[i];
+	}
+	PriorityQueue<int, Greater<int>, 2> h(sa);	//二叉最大堆，O(n)建堆
+	cout<<h.Top()<<endl;			//9
+*/
+
+#endif
@@ -0,0 +1,142 @@
+#ifndef __ROPE_H__
+#define __ROPE_H__
+
+#include "Object.h"
+#include "String.h"
+#include "StringView.h"
+//ostream
+#include <iostream>
+
+/*
+Rope（用于编辑大文本）
+	String是一块连续的空间，Insert和Remove(i, len)需要移动i之后的全部内容
+	编辑一个100MB的文档，每一次插入、删除都是O(n)
+
+	Rope将文本切分为若干块（chunk，每块不超过CHUNK_SIZE个字节），块按顺序组织成一棵平衡树
+	每个结点记录子树的总长度，按位置查找只需要沿着一条路径向下
+		Insert、Remove、Sub		O(log(n))
+		+、Append				O(log(n))，不拷贝任何内容
+		operator[]				O(log(n))
+		Rope(String)			O(n)，直接生成完全平衡的树
+		ToString				O(n)，只申请一次空间
+
+实现：
+	隐式Treap（按位置而不是按键值组织的Treap），核心操作只有两个：
+		_split(n, i)	将n分为[0, i)和[i, length)两棵树，i在某个块的内部时把这个块一分为二
+		_merge(a, b)	将b接在a之后
+	Insert = split + merge + merge，Remove = split + split + merge，Sub = split + split
+	合并时不使用固定的优先级，而是以 a的结点数 / (a + b的结点数) 的概率选择a的根作为根
+	这样与结点的来源无关，树的期望高度始终为O(log(n))（共享结点之后固定的优先级会产生相关性）
+
+	插入的内容较短并且所在的块还有空间时，直接在块中插入，不增加结点
+	删除的范围在一个块的内部时也直接在块中删除，逐个字符编辑时块的数量不会持续增长
+
+共享结点（Copy on write）：
+	结点带有引用计数，拷贝Rope、Sub、+、插入另一个Rope都只共享结点，不拷贝内容
+	修改之前通过_own复制引用计数大于1的结点，只有从根到修改位置的一条路径会被复制
+	因此 Rope b = a; b.Insert(...) 不会影响a，代价是O(log(n))个结点
+
+注意：
+	引用计数不是原子操作，共享结点的两个Rope不能在不同线程中同时使用
+	Remove与String的Remove相同，i不在[0, length)时不做任何操作，超过尾部的部分忽略
+	Sub与String的Sub相同，i不在[0, length)时抛出异常，超过尾部的部分忽略
+*/
+
+namespace YzcLib{
+
+class Rope: public Object{
+public:
+	//每个块最多容纳的字节数，加上结点的其他成员约为512字节
+	enum{ CHUNK_SIZE = 464 };
+protected:
+	struct Node: public Object{
+		Node* left;
+		Node* right;
+		unsigned int refs;				//引用计数
+		unsigned int size;				//本块的字节数
+		unsigned int length;			//子树的总字节数
+		unsigned int count;				//子树的结点数
+		char data[CHUNK_SIZE];
+	};
+
+	Node* m_root;
+	unsigned long long m_seed;			//_merge使用的随机数（xorshift）
+
+	static Node* _create(const char* s, unsigned int len);
+	static void _retain(Node* n);
+	static void _release(Node* n);
+	//保证n只被当前的树引用（引用计数大于1时复制一份），之后才能修改n
+	static void _own(Node*& n);
+	static void _update(Node* n);
+	static unsigned int _length(const Node* n);
+	static unsigned int _count(const Node* n);
+
+	//s[0, len)按块生成完全平衡的树
+	static Node* _build(const char* s, unsigned int len);
+	//以下两个函数都会消耗参数的引用，返回新的引用
+	static void _split(Node* n, unsigned int i, Node*& l, Node*& r);
+	Node* _merge(Node* a, Node* b);
+	unsigned int _random(unsigned int n);
+
+	//在块的内部插入、删除，空间不够或者跨越多个块时返回false
+	bool _insert_local(unsigned int i, const char* s, unsigned int len);
+	bool _remove_local(unsigned int i, unsigned int len);
+	void _insert(unsigned int i, Node* t);
+
+	static void _copy(const Node* n, String& s);
+	static void _write(const Node* n, ostream& out);
+public:
+	Rope();
+	//const char*和String都通过StringView构造（只有一个转换构造函数，Insert、Append不会产生二义性）
+	Rope(const StringView& s);
+	//共享结点，O(1)
+	Rope(const Rope& r);
+	Rope& operator = (const Rope& r);
+
+	unsigned int Length() const;
+	//块的个数
+	unsigned int Chunks() const;
+
+	//合法范围为[0, length)，只读
+	char operator [](unsigned int i) const;
+
+	//插入位置的取值范围为[0, length]，否则抛出异常
+	Rope& Insert(int i, const StringView& s);
+	Rope& Insert(int i, const Rope& r);
+	Rope& Remove(int i, unsigned int len);
+	Rope Sub(int i, unsigned int len) const;
+
+	Rope& Append(const StringView& s);
+	Rope& Append(const Rope& r);
+	Rope& operator += (const Rope& r);
+	Rope operator + (const Rope& r) const;
+
+	String ToString() const;
+
+	friend ostream& operator <<(ostream& out, const Rope& r);
+
+	~Rope();
+};
+
+}
+
+/*
+Test code
+	Rope r("hello world");
+	r.Insert(5, ",");
+	r.Insert(r.Length(), "!");
+	cout<<r<<endl;					//hello, world!
+
+	Rope s = r.Sub(7, 5);
+	r.Remove(0, 7);
+	cout<<s<<" "<<r<<endl;			//world world!
+
+	Rope big(String('x'));
+	for(int i = 0; i < 20; i++){
+		big += big;					//每次O(log(n))，长度翻倍
+	}
+	cout<<big.Length()<<endl;		//1048576
+	cout<<(s + r).ToString()<<endl;	//worldworld!
+*/
+
+#endif
@@ -2,6 +2,9 @@
 #define __SORT_H__
 
 #include "Object.h"
+#include "Array.h"
+#include "LinkList.h"
+#include "LoserTree.h"
 /*
 Sort类中的排序函数
 
@@ -16,6 +19,12 @@ Shell_Sort(T a[], unsigned int len, bool model)
 Quick_Sort(T a[],unsigned int len, bool model );
 
 Merge_Sort(T a[],unsigned int len, bool model )
+
+KWay_Merge(Array<T>* const src[], unsigned int k, Array<T>& dst, bool model)
+
+Index_Sort(T a[], unsigned int len, Array<unsigned int>& idx, bool model)
+
+Permute(T a[], unsigned int len, Array<unsigned int>& idx)
 */
 /*
 排序的一般定义：排序是计算机内部经常进行的一种操作，其目的是将一组“无序”的数据元素调整为有序的数据元素
@@ -137,6 +146,10 @@ private:
 
 	template< typename T>
 	static void MergePass(T a[], T helper[], unsigned int gap, unsigned int len, bool model = true);
+
+	//索引排序中对下标进行归并，比较的是下标所对应的元素
+	template< typename T>
+	static void _index_merge(T a[], unsigned int idx[], unsigned int helper[], unsigned int begin, unsigned int mid, unsigned int end, bool model);
 	//快速排序中将序列分成大于和小于基准的部分
 	template< typename T>
 	static int _partition(T a[], unsigned int begin, unsigned int end, bool model = true);
@@ -398,6 +411,53 @@ public:
 
 	template< typename T>
 	static void Quick_Sort(Array<T>& a, bool model = true);
+
+	/*
+	多路归并
+		Merge只能归并同一个缓冲区中相邻的两段，若有k个已经有序的序列，两两归并需要生成大量中间结果
+		借助败者树（LoserTree）同时对k路进行比赛，每输出一个元素只需要 ceil(log(k)) 次比较
+		输出直接写入dst，不生成任何中间的归并结果
+
+		src中的每一路必须已经按照model有序，空指针视为空序列
+		dst的长度必须不小于所有序列长度之和，否则抛异常
+		相等元素按照路的编号先后输出，归并是稳定的
+		时间复杂度O(nlog(k))，n为元素总数
+	*/
+	template< typename T>
+	static void KWay_Merge(Array<T>* const src[], unsigned int k, Array<T>& dst, bool model = true);
+
+	template< typename T>
+	static void KWay_Merge(LinkList<T>* const src[], unsigned int k, Array<T>& dst, bool model = true);
+
+	/*
+	索引排序（argsort）
+		_swap对于大对象（如下方的Test，或者String）开销很大，排序过程中每个元素会被移动O(log(n))次甚至更多
+		索引排序不移动元素本身，而是对下标数组进行排序
+			排序后 a[idx[0]], a[idx[1]], ..., a[idx[len - 1]] 为有序序列
+		与代理模式思想相同，但不需要为每个类型编写代理类
+
+		idx的长度必须等于len，否则抛异常
+		对下标进行归并排序，索引排序是稳定的，时间复杂度O(nlog(n))，辅助空间为len个下标
+	*/
+	template< typename T>
+	static void Index_Sort(T a[], unsigned int len, Array<unsigned int>& idx, bool model = true);
+
+	template< typename T>
+	static void Index_Sort(Array<T>& a, Array<unsigned int>& idx, bool model = true);
+
+	/*
+	按照下标数组重排元素
+		执行后 a[i] 为执行前的 a[idx[i]]
+		沿着置换的环进行移动：每个环只需要一个临时对象，每个元素最多被移动一次
+		已经归位的位置将 idx[i] 置为 i 作为标记，因此执行后idx变为恒等置换
+
+		idx必须是[0, len)的一个排列，否则抛异常（此时a可能已经被部分重排）
+	*/
+	template< typename T>
+	static void Permute(T a[], unsigned int len, Array<unsigned int>& idx);
+
+	template< typename T>
+	static void Permute(Array<T>& a, Array<unsigned int>& idx);
 };
 
 template< typename T>
@@ -735,6 +795,202 @@ void Sort::Quick_Sort(Array<T>& a, bool model ){
 }
 
 
+//多路归并
+
+template< typename T>
+void Sort::KWay_Merge(Array<T>* const src[], unsigned int k, Array<T>& dst, bool model){
+	unsigned int total = 0;
+	if((src == NULL) && (k > 0)){
+		THROW_EXCEPTION(InvalidParameterException, "Parameter src is NULL...");
+	}
+	for(unsigned int i = 0; i < k; i++){
+		total += src[i] ? src[i]->Length() : 0;
+	}
+	if(dst.Length() < total){
+		THROW_EXCEPTION(InvalidParameterException, "No enough space in dst for k-way merge...");
+	}
+
+	if(k > 0){
+		LoserTree<T> lt(k, model);
+		//pos[i]记录第i路下一个要读入的位置
+		DynamicArray<unsigned int> pos(k);
+
+		for(unsigned int i = 0; i < k; i++){
+			pos[i] = 1;
+			(src[i] && src[i]->Length() > 0) ? lt.Set(i, src[i]->GetArray()[0]) : lt.Exhaust(i);
+		}
+		lt.Build();
+
+		T* out = dst.GetArray();
+		for(int w = lt.Winner(), n = 0; w >= 0; w = lt.Winner(), n++){
+			out[n] = lt.Top();
+			//胜者路还有元素则读入下一个，否则该路耗尽
+			if(pos[w] < src[w]->Length()){
+				lt.Replace(src[w]->GetArray()[pos[w]++]);
+			}
+			else{
+				lt.Pop();
+			}
+		}
+	}
+}
+
+/*
+链表不支持随机访问，使用链表自身的游标顺序读取，每一路只遍历一次
+*/
+template< typename T>
+void Sort::KWay_Merge(LinkList<T>* const src[], unsigned int k, Array<T>& dst, bool model){
+	unsigned int total = 0;
+	if((src == NULL) && (k > 0)){
+		THROW_EXCEPTION(InvalidParameterException, "Parameter src is NULL...");
+	}
+	for(unsigned int i = 0; i < k; i++){
+		total += src[i] ? src[i]->Length() : 0;
+	}
+	if(dst.Length() < total){
+		THROW_EXCEPTION(InvalidParameterException, "No enough space in dst for k-way merge...");
+	}
+
+	if(k > 0){
+		LoserTree<T> lt(k, model);
+
+		for(unsigned int i = 0; i < k; i++){
+			if(src[i] && src[i]->Move(0) && !src[i]->End()){
+				lt.Set(i, src[i]->Current());
+			}
+			else{
+				lt.Exhaust(i);
+			}
+		}
+		lt.Build();
+
+		T* out = dst.GetArray();
+		for(int w = lt.Winner(), n = 0; w >= 0; w = lt.Winner(), n++){
+			out[n] = lt.Top();
+			src[w]->Next();
+			if(!src[w]->End()){
+				lt.Replace(src[w]->Current());
+			}
+			else{
+				lt.Pop();
+			}
+		}
+	}
+}
+
+
+
+
+//索引排序
+
+template< typename T>
+void Sort::_index_merge(T a[], unsigned int idx[], unsigned int helper[], unsigned int begin, unsigned int mid, unsigned int end, bool model){
+	unsigned int i = begin;
+	unsigned int j = mid + 1;
+	unsigned int k = begin;
+	while((i <= mid) && (j <= end)){
+		//只有右侧严格更优时才取右侧，保证稳定性
+		if(model ? (a[idx[j]] < a[idx[i]]) : (a[idx[j]] > a[idx[i]])){
+			helper[k++] = idx[j++];
+		}
+		else{
+			helper[k++] = idx[i++];
+		}
+	}
+	while(i <= mid){
+		helper[k++] = idx[i++];
+	}
+	while(j <= end){
+		helper[k++] = idx[j++];
+	}
+}
+
+/*
+与Merge_Sort相同，自底向上进行归并，在idx和helper之间交替，避免每一轮都拷贝回去
+*/
+template< typename T>
+void Sort::Index_Sort(T a[], unsigned int len, Array<unsigned int>& idx, bool model){
+	if(idx.Length() != len){
+		THROW_EXCEPTION(InvalidParameterException, "Length of idx must be equal to len...");
+	}
+
+	unsigned int* src = idx.GetArray();
+	for(unsigned int i = 0; i < len; i++){
+		src[i] = i;
+	}
+
+	if(len > 1){
+		unsigned int* helper = new unsigned int[len];
+		if(helper == NULL){
+			THROW_EXCEPTION(NotEnoughMemoryException, "No memory to create helper array...");
+		}
+		unsigned int* dst = helper;
+
+		for(unsigned int gap = 1; gap < len; gap *= 2){
+			unsigned int i = 0;
+			for(; i + gap < len; i += 2 * gap){
+				unsigned int end = (i + 2 * gap - 1 < len) ? (i + 2 * gap - 1) : (len - 1);
+				_index_merge(a, src, dst, i, i + gap - 1, end, model);
+			}
+			//剩余不足一组的部分直接拷贝
+			for(; i < len; i++){
+				dst[i] = src[i];
+			}
+			unsigned int* temp = src;
+			src = dst;
+			dst = temp;
+		}
+
+		//结果不在idx上时，拷贝回idx
+		if(src != idx.GetArray()){
+			for(unsigned int i = 0; i < len; i++){
+				dst[i] = src[i];
+			}
+		}
+		delete[] helper;
+	}
+}
+
+template< typename T>
+void Sort::Index_Sort(Array<T>& a, Array<unsigned int>& idx, bool model){
+	Index_Sort(a.GetArray(), a.Length(), idx, model);
+}
+
+template< typename T>
+void Sort::Permute(T a[], unsigned int len, Array<unsigned int>& idx){
+	if(idx.Length() != len){
+		THROW_EXCEPTION(InvalidParameterException, "Length of idx must be equal to len...");
+	}
+
+	unsigned int* p = idx.GetArray();
+	for(unsigned int i = 0; i < len; i++){
+		//已经在正确的位置上（或者已经处理过的环）
+		if(p[i] == i) continue;
+
+		//环的起点先放到临时对象中，环上其余元素依次前移，最后将临时对象放到环的终点
+		T temp = a[i];
+		unsigned int j = i;
+		while(1){
+			unsigned int k = p[j];
+			//k越界，或k已经归位但不是环的起点，说明idx不是一个排列
+			if((k >= len) || ((k != i) && (p[k] == k))){
+				THROW_EXCEPTION(InvalidParameterException, "Parameter idx is not a permutation...");
+			}
+			p[j] = j;
+			if(k == i){
+				a[j] = temp;
+				break;
+			}
+			a[j] = a[k];
+			j = k;
+		}
+	}
+}
+
+template< typename T>
+void Sort::Permute(Array<T>& a, Array<unsigned int>& idx){
+	Permute(a.GetArray(), a.Length(), idx);
+}
 
 
 // 问题分析
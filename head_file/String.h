@@ -2,6 +2,10 @@
 #define __STRING_H__
 
 #include "Object.h"
+#include "StringView.h"
+#include "DynamicArray.h"
+//SharedPointer
+#include "Pointer.h"
 //ostream, istream
 #include <iostream>
 
@@ -37,19 +41,72 @@
 	对于C++的输出，如果类型是const char*,那么，cout会自动输出指针所指字符串，因此对于想得到string内容的函数，返回值是const char*。
 	如果想得到字符串的指针，需要用static_cast将其转换成void*，然后用cout输出。
 
-	字符串类中的字符串都是分布在堆空间上的
+	长度超过SSO_SIZE的字符串分布在堆空间上，短字符串存放在对象内部（见下方的短字符串优化）
+
+二进制内容：
+	String以length为准，内容中可以包含'\0'（通过String(s, len)、StringView、+=、+、Insert构造）
+	比较、拼接、查找、输出（<<）都按长度进行，不依赖'\0'
+	Str()依旧以'\0'结尾，作为c字符串使用时只能看到第一个'\0'之前的部分
+	参数为const char*的函数依旧按c字符串处理（通过strlen得到长度）
+
+子串查找：
+	IndexOf、Remove、Replace都通过StringSearch::Find查找，根据子串长度和CPU选择memchr、SIMD过滤、Two-Way或者KMP
+
+短字符串优化（Small String Optimization）：
+	每个String都要malloc一次，即使只有一个字符，operator+也要再malloc一次，小字符串的分配开销远大于拷贝本身
+	因此在对象内部放置一个 SSO_SIZE + 1 字节的缓冲区，长度不超过SSO_SIZE的字符串直接存储在对象内部，不访问堆空间
+	str 指向 m_sso 时为短字符串，否则指向堆空间
+	Str()的语义不变：依旧返回以'\0'结尾的字符串，在下一次修改之前有效
+	注意：只有堆空间才能free，释放之前必须通过_is_local()判断
+
+容量（capacity）：
+	原来的 s += t 等价于 s = s + t，每次追加都要malloc新的空间，拷贝两部分内容，赋值时再strdup一次
+	逐个字符追加n个字符的复杂度为O(n^2)，并且每次追加两次内存申请
+	因此记录当前空间能够容纳的最大长度m_capacity，追加时空间不够才扩容，并且容量按照几何级数增长（至少翻倍）
+	连续追加n个字符总共只需要O(log(n))次内存申请，+=的均摊复杂度为O(1)
+	需要拼接大量片段时，也可以使用StringBuilder，最后一次性生成String
 */
 using namespace std;
 namespace YzcLib{
 
+class StringTokenizer;
+
 class String: public Object{
+public:
+	//内置缓冲区能够容纳的最大长度（不含'\0'），加上str、length和哈希值，String对象大小为56字节
+	enum{ SSO_SIZE = 23 };
 protected:
 	char* str;
 	unsigned int length;
+	unsigned int m_capacity;	//当前空间能容纳的最大长度（不含'\0'），短串为SSO_SIZE
+	char m_sso[SSO_SIZE + 1];
+	//缓存的哈希值，0表示还没有计算，所有修改内容的操作（包括非const的operator[]）都要将其清0
+	mutable unsigned long long m_hash;
 
 	//构造函数不能够复用，复用会导致产生临时对象，因此采用重新定义一个函数，在每个构造函数里调用，以此达到函数复用
 	void _init(const char* s);
-	bool _equal(const char* s1, const char* s2) const;
+	void _init(const char* s, unsigned int len);
+	//是否使用内置缓冲区
+	bool _is_local() const;
+	//为长度为len的内容准备空间，短串返回内置缓冲区，长串申请堆空间，申请失败返回NULL
+	//调用者需要保证内置缓冲区中的原有内容已经不再需要
+	char* _alloc(unsigned int len);
+	//释放堆空间（内置缓冲区无需释放）
+	void _release();
+	//将内容替换为s的前len个字符，s可以指向自身的内容
+	void _assign(const char* s, unsigned int len);
+	//保证容量不小于capacity，按几何级数扩容，保留原有内容
+	void _reserve(unsigned int capacity);
+	//在尾部追加s的前len个字符，s可以指向自身的内容
+	void _append(const char* s, unsigned int len);
+	//按长度比较，返回值与memcmp相同，公共部分相同时短的较小
+	int _compare(const char* s, unsigned int len) const;
+	//长度不同直接返回false，否则memcmp
+	bool _equal(const char* s, unsigned int len) const;
+	//按长度拼接、插入、替换，内容中可以包含'\0'
+	String _concat(const char* s, unsigned int len) const;
+	String& _insert(int i, const char* s, unsigned int len);
+	String& _replace(const char* t, unsigned int tl, const char* s, unsigned int sl);
 
 /*
 朴素字符串查找算法：
@@ -120,13 +177,28 @@ KMP算法的实现：
 */
 
 	//制作部分匹配表
-	int* _make_pmt(const char* p, int* pmt, unsigned int len) const;
+	static int* _make_pmt(const char* p, int* pmt, unsigned int len);
 	int _kmp(const char* p) const;
+	static int _kmp(const char* s, unsigned int sl, const char* p, unsigned int pl);
+
+	//StringSearch在不支持SIMD时使用KMP
+	friend class StringSearch;
+	//Pattern预先生成部分匹配表
+	friend class Pattern;
+	//Rope按块拼接，只申请一次空间
+	friend class Rope;
+
+	//查找p的前pl个字符，通过StringSearch选择最快的算法
+	int _find(const char* p, unsigned int pl) const;
+	//从左到右只扫描一遍，查找t所有不重叠的出现位置，pos不为NULL时按顺序记录（pos的长度可能大于出现次数），返回出现的次数
+	unsigned int _find_all(const StringView& t, DynamicArray<int>* pos) const;
 
 public:
 //构造函数
 String();
 String(const char* s);
+//使用s的前len个字符构造
+String(const char* s, unsigned int len);
 String(const String& s);
 String(const char c);
 
@@ -134,6 +206,9 @@ String(const char c);
 const char* Str() const;
 //获取string长度
 unsigned int Length()const;
+//获取当前容量，以及预留容量（预先知道最终长度时，可以避免多次扩容）
+unsigned int Capacity() const;
+void Reserve(unsigned int capacity);
 
 /*
 输入输出操作符重载
@@ -142,7 +217,7 @@ unsigned int Length()const;
 */
 
 friend ostream& operator <<(ostream& out,const String& s);
-friend istream& operator >>(istream& in, const String& s);
+friend istream& operator >>(istream& in, String& s);
 
 /*
 操作符重载，每一个操作符都要实现两个版本
@@ -187,6 +262,8 @@ bool StartWith(const char* s) const;
 bool StartWith(const String& s) const;
 bool EndOf(const char* s) const;
 bool EndOf(const String& s) const;
+bool StartWith(const StringView& s) const;
+bool EndOf(const StringView& s) const;
 
 //在指定位置插入字符串
 String& Insert(int i, const char* s);
@@ -204,6 +281,7 @@ String& Trim();
 //子串查找
 int IndexOf(const char* s) const;
 int IndexOf(const String& s) const;
+int IndexOf(const StringView& s) const;
 
 /*
 在字符串中将指定的子串删除
@@ -233,6 +311,22 @@ String& Replace(const String& t, const char* s);
 String& Replace(const char* t, const String& s);
 String& Replace(const String& t, const String& s);
 
+/*
+对所有出现的位置进行操作
+	从左到右查找不重叠的出现位置（"aaaa"中"aa"出现2次），空串不会出现
+	查找只进行一遍，子串只编译一次（Pattern）
+
+	ReplaceAll/RemoveAll：
+		s不比t长时，一边查找一边在原有空间中前移，不申请空间
+		s比t长时，先记录所有位置，再按最终的长度一次性申请空间，每个字符只拷贝一次
+		逐个调用Replace的复杂度为O(k * n)，并且需要k次扩容
+*/
+unsigned int Count(const StringView& t) const;
+//出现的位置，按从小到大排列
+SharedPointer<Array<int>> FindAll(const StringView& t) const;
+String& ReplaceAll(const StringView& t, const StringView& s);
+String& RemoveAll(const StringView& t);
+
 /*
 从字符串中创建子串
 	以 i 为起点提取长度为 len 的子串
@@ -240,6 +334,33 @@ String& Replace(const String& t, const String& s);
 */
 String Sub(int i, unsigned int len) const;
 
+/*
+零拷贝的视图操作
+	Sub/Trim都会生成新的String，对一个大的缓冲区进行分词时，每个子串都要拷贝一次
+	视图只记录指针和长度，不申请任何空间
+	视图指向String内部的空间，String被修改或析构之后，视图失效
+*/
+StringView View() const;
+//与Sub的参数检测相同，返回[i, i + len)的视图
+StringView SubView(int i, unsigned int len) const;
+//去掉两端空格后的视图，String本身不变
+StringView TrimView() const;
+
+/*
+零拷贝分词，详见StringTokenizer
+	Split		以整个delim作为分隔符，保留空词
+	Tokenize	charset中的任意字符都是分隔符，跳过空词
+*/
+StringTokenizer Split(const StringView& delim) const;
+StringTokenizer Tokenize(const StringView& charset) const;
+
+/*
+哈希值（wyhash，详见Hash.h）
+	第一次调用时计算并缓存在对象中，之后为O(1)，修改内容之后重新计算
+	与内容相同的StringView的哈希值相同
+*/
+unsigned long long Hash() const;
+
 
 
 ~String();
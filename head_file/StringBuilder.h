@@ -0,0 +1,74 @@
+#ifndef __STRINGBUILDER_H__
+#define __STRINGBUILDER_H__
+
+#include "Object.h"
+#include "String.h"
+
+/*
+StringBuilder
+	需要拼接大量片段时（例如生成日志、报表），即使String的+=已经是均摊O(1)，
+	中间结果依旧是一个完整的String对象，容量翻倍时会留下空闲空间
+
+	StringBuilder只负责累积片段：
+		内部维护一个按几何级数增长的缓冲区，Append只做拷贝
+		ToString()时一次性生成String，只申请一次恰好大小的空间
+
+	StringBuilder sb;
+	sb.Append("id=").Append(12).Append(',').Append(name);
+	String s = sb.ToString();
+
+注意：
+	StringBuilder禁止拷贝：m_buf是malloc申请的缓冲区，析构时释放，浅拷贝后两个对象会释放同一块空间
+	缓冲区中的内容不以'\0'结尾，只能通过ToString()获取
+*/
+
+namespace YzcLib{
+
+class StringBuilder: public Object{
+protected:
+	char* m_buf;
+	unsigned int m_length;
+	unsigned int m_capacity;
+
+	//保证容量不小于capacity，按几何级数扩容
+	void _reserve(unsigned int capacity);
+
+	StringBuilder(const StringBuilder&);
+	StringBuilder& operator = (const StringBuilder&);
+public:
+	//capacity为预留的初始容量
+	StringBuilder(unsigned int capacity = 64);
+
+	//追加片段，返回自身引用，方便链式操作
+	StringBuilder& Append(const char* s);
+	StringBuilder& Append(const char* s, unsigned int len);
+	StringBuilder& Append(const String& s);
+	StringBuilder& Append(char c);
+	StringBuilder& Append(int i);
+
+	unsigned int Length() const;
+	//清空内容，保留已经申请的空间，方便重复使用
+	void Clear();
+
+	//一次性生成String
+	String ToString() const;
+
+	~StringBuilder();
+};
+
+}
+
+/*
+Test code
+	StringBuilder sb(4);
+	for(int i = 0; i < 5; i++){
+		sb.Append("item").Append(i).Append(',');
+	}
+	cout<<sb.ToString()<<endl;		//item0,item1,item2,item3,item4,
+	cout<<sb.Length()<<endl;		//30
+
+	sb.Clear();
+	cout<<sb.Append('a').Append(String("bc")).ToString()<<endl;	//abc
+*/
+
+#endif
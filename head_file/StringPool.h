@@ -0,0 +1,89 @@
+#ifndef __STRINGPOOL_H__
+#define __STRINGPOOL_H__
+
+#include "Object.h"
+#include "String.h"
+#include "StringView.h"
+#include "DynamicArray.h"
+
+/*
+字符串驻留池（StringPool）
+	大量重复的字符串（例如日志中的主机名、字段名）每个都是一个String，各自拥有一份堆空间
+	比较两个字符串需要逐个字节比较
+
+	StringPool中每种内容只保存一份：
+		Intern(s)		返回s对应的句柄（Handle），内容第一次出现时拷贝到池中，否则返回已有的句柄
+		句柄是一个整数，同一个池中内容相同当且仅当句柄相同，比较为O(1)
+		Get(h)			通过句柄获取内容（StringView），Str(h)获取以'\0'结尾的字符串
+
+实现：
+	内容存放在按块申请的连续空间（arena）中，块的大小按几何级数增长，每个字符串不单独申请空间
+	句柄为字符串在池中的编号，通过编号查找起始位置、长度和哈希值
+	哈希表使用开放地址法（线性探测），容量为2的幂，装载因子不超过1/2
+	表中记录 句柄 + 1（0为空），探测时先比较哈希值，相同时才比较内容
+
+注意：
+	池中的内容在池析构之前一直有效，Get返回的视图在池析构之前一直可以使用
+	StringPool禁止拷贝：Get返回的视图直接指向池中的块，块在析构时释放，浅拷贝会重复释放
+*/
+
+namespace YzcLib{
+
+class StringPool: public Object{
+public:
+	typedef unsigned int Handle;
+protected:
+	DynamicArray<char*> m_blocks;				//所有申请过的块，析构时释放
+	unsigned int m_block_count;
+	char* m_block;								//当前块
+	unsigned int m_used;						//当前块已经使用的大小
+	unsigned int m_size;						//当前块的大小
+
+	DynamicArray<const char*> m_str;			//句柄对应的内容
+	DynamicArray<unsigned int> m_len;
+	DynamicArray<unsigned long long> m_hash;
+	unsigned int m_count;
+
+	DynamicArray<unsigned int> m_table;			//哈希表，记录句柄 + 1，0为空
+	unsigned int m_mask;						//容量 - 1
+
+	//在arena中拷贝一份s，以'\0'结尾
+	const char* _store(const char* s, unsigned int len);
+	//s所在的哈希表位置（已有的或者空位）
+	unsigned int _slot(const char* s, unsigned int len, unsigned long long hash) const;
+	void _rehash(unsigned int capacity);
+
+	StringPool(const StringPool&);
+	StringPool& operator = (const StringPool&);
+public:
+	StringPool();
+
+	Handle Intern(const StringView& s);
+	//查找s是否已经在池中，在池中时通过h返回句柄
+	bool Find(const StringView& s, Handle& h) const;
+
+	StringView Get(Handle h) const;
+	const char* Str(Handle h) const;
+
+	//不同内容的个数
+	unsigned int Count() const;
+
+	~StringPool();
+};
+
+}
+
+/*
+Test code
+	StringPool pool;
+	StringPool::Handle a = pool.Intern("host-01");
+	StringPool::Handle b = pool.Intern(String("host-") + "01");
+	StringPool::Handle c = pool.Intern("host-02");
+
+	cout<<(a == b)<<endl;			//1
+	cout<<(a == c)<<endl;			//0
+	cout<<pool.Str(c)<<endl;		//host-02
+	cout<<pool.Count()<<endl;		//2
+*/
+
+#endif
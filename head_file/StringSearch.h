@@ -0,0 +1,92 @@
+#ifndef __STRINGSEARCH_H__
+#define __STRINGSEARCH_H__
+
+#include "Object.h"
+
+/*
+子串查找引擎
+	String::_kmp每次查找都要new一个部分匹配表，然后逐个字节比较，对于大的文本，查找速度远低于内存带宽
+
+	Find根据子串长度和CPU支持的指令集选择算法：
+		pl == 1			memchr（c库中已经向量化）
+		pl > 1			首尾字节SIMD过滤 + memcmp验证，运行时检测CPU，支持AVX2时每次处理32字节，否则使用SSE2每次处理16字节
+						验证失败过多时（特殊构造的文本），从当前位置改用Two-Way算法
+						Two-Way为O(n + m)时间，O(1)额外空间，保证不会出现O(n * m)的最坏情况
+		不支持SIMD时	短子串使用KMP（部分匹配表放在栈上，不申请堆空间），长子串使用Two-Way
+
+首尾字节SIMD过滤：
+	s -> x x a b c d x x a x x d ...
+	p -> a b c d
+
+	first = 每个字节都是p[0]的向量，last = 每个字节都是p[pl - 1]的向量
+	同时读入 s[i, i + 16) 和 s[i + pl - 1, i + pl - 1 + 16)
+	两次比较的结果按位与，得到的掩码中第k位为1，表示s[i + k]与p的首尾字节都相同
+	只有这些候选位置才需要memcmp验证中间的字节，对于一般的文本，候选位置很少
+
+Two-Way算法（Crochemore-Perrin）：
+	将p分解为 p = u v，其中v是p的最大后缀（按字典序的最大后缀和反序的最大后缀中较长的一个）
+	先从左到右比较v，失配时按已经匹配的长度右移；v匹配后再从右到左比较u，失配时按p的周期右移
+	p具有周期性时，记录上一次已经匹配的前缀长度（memory），保证每个字符最多比较常数次
+
+	分解只与p有关，同一个子串重复查找时可以用Factorize预先计算一次，再传给Find、TwoWay（见Pattern）
+
+所有函数都按长度查找，不依赖'\0'，查找s的前sl个字符中p的前pl个字符第一次出现的位置
+pl为0或者找不到时返回-1（与String::IndexOf原有的行为相同）
+*/
+
+namespace YzcLib{
+
+class StringSearch: public Object{
+public:
+	//Two-Way的分解：p = u v，ell为u的最后一个位置，per为失配时的移动距离，periodic表示p是否是周期的
+	struct Factor: public Object{
+		int ell;
+		int per;
+		bool periodic;
+	};
+protected:
+	//bounded为true时限制验证失败的次数，超过时返回-1，并通过stop返回放弃的位置
+	typedef int (*Filter)(const char* s, unsigned int sl, const char* p, unsigned int pl, bool bounded, unsigned int& stop);
+
+	//运行时选择SIMD过滤函数，不支持SIMD时返回NULL
+	static Filter _select();
+	//最大后缀，返回后缀起点的前一个位置，period为后缀的周期，reverse为true时使用反序
+	static int _max_suffix(const unsigned char* p, unsigned int pl, unsigned int& period, bool reverse);
+	//f为NULL时，在需要Two-Way时才计算分解
+	static int _find(const char* s, unsigned int sl, const char* p, unsigned int pl, const Factor* f);
+public:
+	//不支持SIMD时使用KMP的最大子串长度，更长的子串使用Two-Way
+	enum{ SIMD_MAX = 32 };
+
+	//根据子串长度和CPU选择最快的算法
+	static int Find(const char* s, unsigned int sl, const char* p, unsigned int pl);
+	//使用预先计算的分解，SIMD过滤失效改用Two-Way时不再重新分解
+	static int Find(const char* s, unsigned int sl, const char* p, unsigned int pl, const Factor& f);
+	//计算p的Two-Way分解，pl必须大于0
+	static void Factorize(const char* p, unsigned int pl, Factor& f);
+
+	//以下为各个算法的实现，Find之外单独提供，方便测试和性能比较
+	static int KMP(const char* s, unsigned int sl, const char* p, unsigned int pl);
+	static int TwoWay(const char* s, unsigned int sl, const char* p, unsigned int pl);
+	static int TwoWay(const char* s, unsigned int sl, const char* p, unsigned int pl, const Factor& f);
+	//memchr查找首字节，memcmp验证
+	static int Scalar(const char* s, unsigned int sl, const char* p, unsigned int pl);
+	//CPU不支持时退化为Scalar
+	static int SSE2(const char* s, unsigned int sl, const char* p, unsigned int pl);
+	static int AVX2(const char* s, unsigned int sl, const char* p, unsigned int pl);
+
+	static bool HasSSE2();
+	static bool HasAVX2();
+};
+
+}
+
+/*
+Test code
+	const char* s = "the quick brown fox jumps over the lazy dog";
+	cout<<StringSearch::Find(s, strlen(s), "fox", 3)<<endl;			//16
+	cout<<StringSearch::TwoWay(s, strlen(s), "lazy dog", 8)<<endl;	//35
+	cout<<StringSearch::Find(s, strlen(s), "cat", 3)<<endl;			//-1
+*/
+
+#endif
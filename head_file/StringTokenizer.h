@@ -0,0 +1,93 @@
+#ifndef __STRINGTOKENIZER_H__
+#define __STRINGTOKENIZER_H__
+
+#include "Object.h"
+#include "String.h"
+#include "StringView.h"
+
+/*
+字符串分词（StringTokenizer）
+	用IndexOf + Sub循环分词时，每个子串都要申请空间并拷贝一次
+	StringTokenizer按需逐个查找分隔符，得到的每一个词都是StringView，整个过程不申请任何空间
+
+	使用方式与LinkList的游标相同：
+		Move()		游标定位到第一个词（构造时已经调用一次）
+		Next()		移动到下一个词
+		Current()	当前的词
+		End()		是否已经没有词了
+
+	for(StringTokenizer t = line.Split(","); !t.End(); t.Next()){
+		cout<<t.Current()<<endl;
+	}
+
+两种模式：
+	SPLIT		以整个delim作为分隔符，相邻的分隔符之间为空词，n个分隔符总是得到n + 1个词
+				"a,,b".Split(",")  ->  "a" "" "b"
+	TOKENIZE	delim中的任意一个字符都是分隔符，连续的分隔符视为一个，不产生空词（与strtok相同）
+				"  a \t b ".Tokenize(" \t")  ->  "a" "b"
+
+分隔符的查找：
+	SPLIT通过StringSearch::Find查找，单个字符的分隔符为memchr，多个字符为SIMD过滤
+	TOKENIZE的字符集不超过SIMD_CHARS个字符时，使用SSE2每次比较16个字节（每个字符比较一次，结果按位或），否则逐个字节查表
+
+注意：
+	与StringView相同，StringTokenizer不拥有被分词的字符串，字符串被修改或析构之后失效
+	delim会被拷贝，可以是临时对象
+*/
+
+namespace YzcLib{
+
+class StringTokenizer: public Object{
+public:
+	enum Mode{
+		SPLIT,
+		TOKENIZE
+	};
+protected:
+	StringView m_text;
+	String m_delim;
+	Mode m_mode;
+	unsigned int m_set[8];		//TOKENIZE的字符集，256位的位图
+	unsigned int m_pos;			//下一个词开始查找的位置，大于文本长度时说明已经结束
+	StringView m_current;
+	bool m_end;
+
+	bool _is_delim(unsigned char c) const;
+	//从i开始第一个分隔符的位置，没有返回文本长度
+	unsigned int _find_any(unsigned int i) const;
+	//从i开始第一个不是分隔符的位置，没有返回文本长度
+	unsigned int _skip_any(unsigned int i) const;
+	//从m_pos开始查找下一个词
+	void _advance();
+public:
+	//使用SSE2查找字符集的最大字符个数
+	enum{ SIMD_CHARS = 8 };
+
+	//delim为空时抛出异常
+	StringTokenizer(const StringView& text, const StringView& delim, Mode mode = SPLIT);
+
+	bool Move();
+	bool Next();
+	//已经结束时抛出异常
+	StringView Current() const;
+	bool End() const;
+};
+
+}
+
+/*
+Test code
+	String s = "name,age,,city";
+	for(StringTokenizer t = s.Split(","); !t.End(); t.Next()){
+		cout<<"["<<t.Current()<<"]";					//[name][age][][city]
+	}
+	cout<<endl;
+
+	StringView line = "  GET   /index.html  HTTP/1.1 ";
+	for(StringTokenizer t = line.Tokenize(" "); !t.End(); t.Next()){
+		cout<<"["<<t.Current()<<"]";					//[GET][/index.html][HTTP/1.1]
+	}
+	cout<<endl;
+*/
+
+#endif
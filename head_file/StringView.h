@@ -0,0 +1,99 @@
+#ifndef __STRINGVIEW_H__
+#define __STRINGVIEW_H__
+
+#include "Object.h"
+//ostream
+#include <iostream>
+
+/*
+StringView（字符串视图）
+	String的Sub、Trim以及对缓冲区的分词操作，每得到一个子串都要申请空间并拷贝一次
+	很多时候子串只是用来比较、查找或者输出，并不需要拥有自己的空间
+
+	StringView只记录 起始指针 + 长度，不申请任何空间，也不负责释放
+		构造、拷贝、Sub、Trim都是O(1)
+		内容不要求以'\0'结尾，因此视图不提供Str()，需要c字符串时通过ToString()生成String
+
+注意事项：
+	视图不拥有所指向的空间，视图的有效期不能超过被引用的String（或字符数组）
+	String被修改（+=、Insert、Remove、Replace、Trim、赋值）或析构之后，由它得到的视图全部失效
+	因此视图适合作为函数参数或者局部变量，不适合长期保存
+
+	StringView sv = s.View();
+	StringView word = sv.Sub(0, 5);
+	if(word == "hello") ...
+*/
+
+namespace YzcLib{
+
+class String;
+class StringTokenizer;
+
+class StringView: public Object{
+protected:
+	const char* m_str;
+	unsigned int m_length;
+
+	//按字节比较，返回值与memcmp相同，公共部分相同时短的较小
+	int _compare(const char* s, unsigned int len) const;
+public:
+	StringView();
+	StringView(const char* s);
+	//s的前len个字符，s中可以包含'\0'
+	StringView(const char* s, unsigned int len);
+	StringView(const String& s);
+
+	//视图的起始位置，不以'\0'结尾
+	const char* Data() const;
+	unsigned int Length() const;
+
+	//当i取值范围不合法时，抛出异常合法范围在[0, length)
+	char operator [](unsigned int i) const;
+
+	bool operator == (const StringView& s) const;
+	bool operator != (const StringView& s) const;
+	bool operator > (const StringView& s) const;
+	bool operator < (const StringView& s) const;
+	bool operator >= (const StringView& s) const;
+	bool operator <= (const StringView& s) const;
+
+	bool StartWith(const StringView& s) const;
+	bool EndOf(const StringView& s) const;
+
+	//子串查找，与String::IndexOf相同使用StringSearch，找不到返回-1
+	int IndexOf(const StringView& s) const;
+
+	//与String::Sub的参数检测相同，返回的视图指向同一块空间
+	StringView Sub(int i, unsigned int len) const;
+	//去掉两端空格后的视图
+	StringView Trim() const;
+
+	//零拷贝分词，得到的词都是视图，详见StringTokenizer
+	StringTokenizer Split(const StringView& delim) const;
+	StringTokenizer Tokenize(const StringView& charset) const;
+
+	//与内容相同的String的哈希值相同，视图不缓存哈希值
+	unsigned long long Hash() const;
+
+	//拷贝出一个String，只有这里会申请空间
+	String ToString() const;
+
+	friend std::ostream& operator <<(std::ostream& out, const StringView& s);
+};
+
+}
+
+/*
+Test code
+	String s = "  hello world  ";
+	StringView sv = s.TrimView();
+
+	cout<<sv<<endl;							//hello world
+	cout<<sv.Length()<<endl;				//11
+	cout<<sv.Sub(6, 5)<<endl;				//world
+	cout<<sv.IndexOf("world")<<endl;		//6
+	cout<<(sv.Sub(0, 5) == "hello")<<endl;	//1
+	cout<<sv.ToString().Str()<<endl;		//hello world
+*/
+
+#endif
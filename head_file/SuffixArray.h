@@ -0,0 +1,110 @@
+#ifndef __SUFFIXARRAY_H__
+#define __SUFFIXARRAY_H__
+
+#include "Object.h"
+#include "StringView.h"
+#include "DynamicArray.h"
+//SharedPointer
+#include "Pointer.h"
+
+/*
+后缀数组（Suffix Array）与LCP数组
+	对同一个大文本反复查询子串是否出现、出现几次，每次IndexOf/Count都要扫描整个文本，复杂度为O(n)
+	后缀数组对文本预处理一次，之后每次查询为O(m * log(n))，与文本的长度基本无关（m为子串长度）
+
+	SA[i]	字典序第i小的后缀的起始位置
+	LCP[i]	后缀SA[i - 1]与SA[i]的最长公共前缀的长度，LCP[0] = 0
+	子串p出现在文本中，当且仅当p是某个后缀的前缀，所有以p开头的后缀在SA中是连续的一段
+	两次二分查找得到这一段的上下界，段的长度即为出现的次数，段中的元素即为出现的位置
+
+构造：
+	SA-IS（Nong, Zhang, Chan 2009），O(n)
+		1.从右向左将每个后缀分为S型（比右边的后缀小）和L型，左边为L型的S型后缀称为LMS后缀
+		2.把LMS后缀放入各自桶的尾部，通过诱导排序（induced sorting）得到所有LMS子串的顺序
+		3.LMS子串按顺序编号，得到长度不超过n/2的新串，所有编号都不同时直接得到LMS后缀的顺序，否则递归
+		4.按LMS后缀的顺序再诱导排序一次，得到SA
+	LCP通过Kasai算法计算，O(n)：rank[i]后移一位时，LCP最多减少1
+
+查询：
+	二分查找时记录p与上下界的公共前缀长度l、r，比较从min(l, r)开始，多数比较不需要从头开始
+	Locate返回的位置按从小到大排列（与String::FindAll相同）
+
+文本来源：
+	Build(text)			拷贝一份文本，text可以在Build之后被修改或者析构
+	BuildFromFile(path)	POSIX系统上通过mmap只读映射文件，由操作系统按需读入，不占用额外的堆空间
+						其他系统上一次性读入堆空间
+
+注意：
+	下标使用int，文本长度不能超过2^31 - 1
+	SA和LCP各占用4n个字节，构造时另外需要最多约13n个字节的临时空间（随机文本约为一半）
+	SuffixArray禁止拷贝：对象拥有mmap映射的区域（或者m_buf），浅拷贝后两个对象会释放同一块区域
+*/
+
+namespace YzcLib{
+
+class SuffixArray: public Object{
+protected:
+	const char* m_text;
+	unsigned int m_length;
+	char* m_buf;					//Build拷贝的文本，或者不支持mmap时读入的文件
+	void* m_map;					//mmap映射的文件
+	size_t m_map_size;
+
+	DynamicArray<int> m_sa;
+	DynamicArray<int> m_lcp;
+
+	void _clear();
+	void _build();
+	void _kasai();
+	//p与后缀SA[i]比较，从前k个字符已知相同的位置开始，k返回公共前缀的长度
+	int _compare(const StringView& p, unsigned int i, unsigned int& k) const;
+	//以p开头的后缀在SA中的范围[lo, hi)
+	void _range(const StringView& p, unsigned int& lo, unsigned int& hi) const;
+
+	SuffixArray(const SuffixArray&);
+	SuffixArray& operator = (const SuffixArray&);
+public:
+	SuffixArray();
+	SuffixArray(const StringView& text);
+
+	void Build(const StringView& text);
+	void BuildFromFile(const char* path);
+
+	StringView Text() const;
+	unsigned int Length() const;
+	//SA[i]、LCP[i]，合法范围为[0, length)
+	int Suffix(unsigned int i) const;
+	int Lcp(unsigned int i) const;
+
+	//p出现的次数（包括重叠的出现），空串出现length次
+	unsigned int Count(const StringView& p) const;
+	bool Contains(const StringView& p) const;
+	//所有出现的位置，按从小到大排列
+	SharedPointer<Array<int>> Locate(const StringView& p) const;
+
+	~SuffixArray();
+};
+
+}
+
+/*
+Test code
+	SuffixArray sa("banana");
+	for(unsigned int i = 0; i < sa.Length(); i++){
+		cout<<sa.Suffix(i)<<" "<<sa.Lcp(i)<<endl;	//5 0, 3 1, 1 3, 0 0, 4 0, 2 2
+	}
+
+	cout<<sa.Count("ana")<<endl;					//2
+	cout<<sa.Contains("nab")<<endl;					//0
+
+	SharedPointer<Array<int>> pos = sa.Locate("an");
+	for(int i = 0; i < pos->Length(); i++){
+		cout<<(*pos)[i]<<endl;						//1, 3
+	}
+
+	SuffixArray corpus;
+	corpus.BuildFromFile("./access.log");
+	cout<<corpus.Count("GET /index.html")<<endl;
+*/
+
+#endif
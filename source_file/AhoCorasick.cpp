@@ -0,0 +1,245 @@
+#include "./../head_file/AhoCorasick.h"
+#include <cstring>
+#include "./../head_file/Exception.h"
+
+namespace YzcLib{
+
+AhoCorasick::AhoCorasick(){
+	m_count = 0;
+	m_total = 0;
+	m_classes = 1;
+	m_states = 0;
+	m_built = false;
+	memset(m_class, 0, sizeof(m_class));
+}
+
+int AhoCorasick::Add(const StringView& p){
+	if(p.Length() == 0){
+		THROW_EXCEPTION(InvalidParameterException, "Pattern of AhoCorasick can not be empty ...");
+	}
+
+	//空间不够时翻倍
+	if(m_count == m_patterns.Length()){
+		m_patterns.resize(m_count ? m_count * 2 : 8);
+	}
+	m_patterns[m_count] = p.ToString();
+	m_total += p.Length();
+	m_built = false;
+
+	return m_count++;
+}
+
+void AhoCorasick::Build(){
+	//字符类，按在关键字中出现的顺序编号，0留给没有出现的字节
+	memset(m_class, 0, sizeof(m_class));
+	m_classes = 1;
+	for(unsigned int i = 0; i < m_count; i++){
+		const char* p = m_patterns[i].Str();
+		for(unsigned int j = 0; j < m_patterns[i].Length(); j++){
+			unsigned char c = p[j];
+			if(m_class[c] == 0){
+				m_class[c] = m_classes++;
+			}
+		}
+	}
+
+	//状态数不超过关键字总长度 + 1，一次申请足够的空间
+	const unsigned int C = m_classes;
+	unsigned int max = m_total + 1;
+	m_next.resize(max * C);
+	m_out.resize(max);
+	m_dict.resize(max);
+	m_same.resize(m_count);
+
+	int* next = m_next.GetArray();
+	for(unsigned int i = 0; i < max * C; i++){
+		next[i] = -1;
+	}
+	for(unsigned int i = 0; i < max; i++){
+		m_out[i] = -1;
+		m_dict[i] = -1;
+	}
+
+	//1.字典树
+	m_states = 1;
+	for(unsigned int i = 0; i < m_count; i++){
+		const char* p = m_patterns[i].Str();
+		int s = 0;
+		for(unsigned int j = 0; j < m_patterns[i].Length(); j++){
+			int& t = next[s * C + m_class[static_cast<unsigned char>(p[j])]];
+			if(t < 0){
+				t = m_states++;
+			}
+			s = t;
+		}
+
+		//相同的关键字结束于同一个状态，用链表连接起来，编号小的在前
+		m_same[i] = -1;
+		if(m_out[s] < 0){
+			m_out[s] = i;
+		}
+		else{
+			int k = m_out[s];
+			while(m_same[k] >= 0) k = m_same[k];
+			m_same[k] = i;
+		}
+	}
+
+	//2.按BFS的顺序计算失配指针，同时将失配指针合并到转移表中
+	DynamicArray<int> fail(m_states);
+	DynamicArray<int> queue(m_states);
+	unsigned int head = 0;
+	unsigned int tail = 0;
+
+	fail[0] = 0;
+	for(unsigned int c = 0; c < C; c++){
+		int& v = next[c];
+		if(v < 0){
+			v = 0;
+		}
+		else{
+			fail[v] = 0;
+			queue[tail++] = v;
+		}
+	}
+
+	while(head < tail){
+		int u = queue[head++];
+		for(unsigned int c = 0; c < C; c++){
+			int& v = next[u * C + c];
+			if(v < 0){
+				v = next[fail[u] * C + c];
+			}
+			else{
+				int f = next[fail[u] * C + c];
+				fail[v] = f;
+				m_dict[v] = (m_out[f] >= 0) ? f : m_dict[f];
+				queue[tail++] = v;
+			}
+		}
+	}
+
+	//释放多余的空间
+	m_next.resize(m_states * C);
+	m_out.resize(m_states);
+	m_dict.resize(m_states);
+
+	m_built = true;
+}
+
+void AhoCorasick::_check() const{
+	if(!m_built){
+		THROW_EXCEPTION(InvalidOperationException, "AhoCorasick must be built before searching ...");
+	}
+}
+
+unsigned int AhoCorasick::_report(int s, int end, DynamicArray<Match>* rst, unsigned int count) const{
+	const int* out = m_out.GetArray();
+	const int* dict = m_dict.GetArray();
+	const int* same = m_same.GetArray();
+
+	//先输出当前状态（最长），再沿着输出链输出较短的
+	for(int t = (out[s] >= 0) ? s : dict[s]; t >= 0; t = dict[t]){
+		for(int id = out[t]; id >= 0; id = same[id]){
+			if(rst != NULL){
+				if(count == rst->Length()){
+					rst->resize(count ? count * 2 : 16);
+				}
+				Match& m = (*rst)[count];
+				m.pattern = id;
+				m.position = end - static_cast<int>(m_patterns.GetArray()[id].Length()) + 1;
+			}
+			count++;
+		}
+	}
+	return count;
+}
+
+SharedPointer<Array<AhoCorasick::Match>> AhoCorasick::FindAll(const StringView& text) const{
+	_check();
+
+	DynamicArray<Match>* rst = new DynamicArray<Match>();
+	if(rst == NULL){
+		THROW_EXCEPTION(NotEnoughMemoryException, "No memory to create result array ...");
+	}
+
+	const int* next = m_next.GetArray();
+	const int* out = m_out.GetArray();
+	const int* dict = m_dict.GetArray();
+	const char* s = text.Data();
+	const unsigned int C = m_classes;
+	unsigned int count = 0;
+	int state = 0;
+
+	for(unsigned int i = 0; i < text.Length(); i++){
+		state = next[state * C + m_class[static_cast<unsigned char>(s[i])]];
+		//大部分状态没有输出，只判断一次
+		if((out[state] >= 0) || (dict[state] >= 0)){
+			count = _report(state, i, rst, count);
+		}
+	}
+
+	rst->resize(count);
+	return rst;
+}
+
+unsigned int AhoCorasick::Count(const StringView& text) const{
+	_check();
+
+	const int* next = m_next.GetArray();
+	const int* out = m_out.GetArray();
+	const int* dict = m_dict.GetArray();
+	const char* s = text.Data();
+	const unsigned int C = m_classes;
+	unsigned int count = 0;
+	int state = 0;
+
+	for(unsigned int i = 0; i < text.Length(); i++){
+		state = next[state * C + m_class[static_cast<unsigned char>(s[i])]];
+		if((out[state] >= 0) || (dict[state] >= 0)){
+			count = _report(state, i, NULL, count);
+		}
+	}
+	return count;
+}
+
+bool AhoCorasick::Contains(const StringView& text) const{
+	_check();
+
+	const int* next = m_next.GetArray();
+	const int* out = m_out.GetArray();
+	const int* dict = m_dict.GetArray();
+	const char* s = text.Data();
+	const unsigned int C = m_classes;
+	bool rst = false;
+	int state = 0;
+
+	for(unsigned int i = 0; !rst && i < text.Length(); i++){
+		state = next[state * C + m_class[static_cast<unsigned char>(s[i])]];
+		rst = (out[state] >= 0) || (dict[state] >= 0);
+	}
+	return rst;
+}
+
+unsigned int AhoCorasick::Patterns() const{
+	return m_count;
+}
+
+unsigned int AhoCorasick::States() const{
+	return m_states;
+}
+
+unsigned int AhoCorasick::Classes() const{
+	return m_classes;
+}
+
+StringView AhoCorasick::GetPattern(int i) const{
+	if((i >= 0) && (static_cast<unsigned int>(i) < m_count)){
+		return m_patterns.GetArray()[i].View();
+	}
+	else{
+		THROW_EXCEPTION(IndexOutOfBoundsException, "Parameter i is invalid ...");
+	}
+}
+
+}
@@ -0,0 +1,177 @@
+#include "./../head_file/DisjointSet.h"
+#include "./../head_file/Exception.h"
+
+namespace YzcLib{
+
+DisjointSet::DisjointSet(int n){
+	m_count = 0;
+	Reset(n);
+}
+
+void DisjointSet::Reset(int n){
+	if(n < 0){
+		THROW_EXCEPTION(InvalidParameterException, "Parameter n is invalid ...");
+	}
+	if(static_cast<unsigned int>(n) != m_parent.Length()){
+		m_parent.resize(n);
+		m_size.resize(n);
+	}
+
+	int* parent = m_parent.GetArray();
+	int* size = m_size.GetArray();
+	for(int x = 0; x < n; x++){
+		parent[x] = x;
+		size[x] = 1;
+	}
+	m_count = n;
+}
+
+void DisjointSet::_check(int x) const{
+	if(!((x >= 0) && (x < Length()))){
+		THROW_EXCEPTION(IndexOutOfBoundsException, "Parameter x is invalid ...");
+	}
+}
+
+int DisjointSet::Find(int x){
+	_check(x);
+	int* parent = m_parent.GetArray();
+
+	while(parent[x] != x){
+		parent[x] = parent[parent[x]];
+		x = parent[x];
+	}
+	return x;
+}
+
+bool DisjointSet::Union(int a, int b){
+	a = Find(a);
+	b = Find(b);
+	bool rst = (a != b);
+
+	if(rst){
+		int* parent = m_parent.GetArray();
+		int* size = m_size.GetArray();
+		//小的集合挂到大的集合下面
+		if(size[a] < size[b]){
+			int t = a;
+			a = b;
+			b = t;
+		}
+		parent[b] = a;
+		size[a] += size[b];
+		m_count--;
+	}
+	return rst;
+}
+
+bool DisjointSet::Connected(int a, int b){
+	return Find(a) == Find(b);
+}
+
+int DisjointSet::Size(int x){
+	return m_size.GetArray()[Find(x)];
+}
+
+int DisjointSet::Count() const{
+	return m_count;
+}
+
+int DisjointSet::Length() const{
+	return m_parent.Length();
+}
+
+
+ConcurrentDisjointSet::ConcurrentDisjointSet(int n){
+	m_count = 0;
+	Reset(n);
+}
+
+void ConcurrentDisjointSet::Reset(int n){
+	if(n < 0){
+		THROW_EXCEPTION(InvalidParameterException, "Parameter n is invalid ...");
+	}
+	if(static_cast<unsigned int>(n) != m_parent.Length()){
+		m_parent.resize(n);
+	}
+
+	int* parent = m_parent.GetArray();
+	for(int x = 0; x < n; x++){
+		parent[x] = x;
+	}
+	m_count = n;
+}
+
+void ConcurrentDisjointSet::_check(int x) const{
+	if(!((x >= 0) && (x < Length()))){
+		THROW_EXCEPTION(IndexOutOfBoundsException, "Parameter x is invalid ...");
+	}
+}
+
+int ConcurrentDisjointSet::Find(int x){
+	_check(x);
+	int* parent = m_parent.GetArray();
+
+	while(true){
+		int p = __atomic_load_n(&parent[x], __ATOMIC_ACQUIRE);
+		if(p == x){
+			break;
+		}
+		int g = __atomic_load_n(&parent[p], __ATOMIC_ACQUIRE);
+		if(p != g){
+			//失败说明parent[x]已经被其他线程修改，无论结果如何都继续向上
+			__atomic_compare_exchange_n(&parent[x], &p, g, false, __ATOMIC_RELEASE, __ATOMIC_RELAXED);
+		}
+		x = g;
+	}
+	return x;
+}
+
+bool ConcurrentDisjointSet::Union(int a, int b){
+	int* parent = m_parent.GetArray();
+
+	while(true){
+		a = Find(a);
+		b = Find(b);
+		if(a == b){
+			return false;
+		}
+
+		//编号大的根挂到编号小的根下面
+		if(a < b){
+			int t = a;
+			a = b;
+			b = t;
+		}
+		int expected = a;
+		if(__atomic_compare_exchange_n(&parent[a], &expected, b, false, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE)){
+			__atomic_sub_fetch(&m_count, 1, __ATOMIC_RELAXED);
+			return true;
+		}
+	}
+}
+
+bool ConcurrentDisjointSet::Connected(int a, int b){
+	const int* parent = m_parent.GetArray();
+
+	while(true){
+		a = Find(a);
+		b = Find(b);
+		if(a == b){
+			return true;
+		}
+		//a仍然是根，说明查找b的过程中a没有被合并，两者确实不在同一个集合
+		if(__atomic_load_n(&parent[a], __ATOMIC_ACQUIRE) == a){
+			return false;
+		}
+	}
+}
+
+int ConcurrentDisjointSet::Count() const{
+	return __atomic_load_n(&m_count, __ATOMIC_RELAXED);
+}
+
+int ConcurrentDisjointSet::Length() const{
+	return m_parent.Length();
+}
+
+}
@@ -0,0 +1,101 @@
+#include "./../head_file/Hash.h"
+#include <cstring>
+
+namespace YzcLib{
+
+static const unsigned long long SECRET[4] = {
+	0x2d358dccaa6c78a5ULL,
+	0x8bb84b93962eacc9ULL,
+	0x4b33a62ed433d4a3ULL,
+	0x4d5a2da51de1aa47ULL
+};
+
+//a * b的128位结果，a为低64位，b为高64位
+void Hash::_mum(unsigned long long& a, unsigned long long& b){
+#if defined(__SIZEOF_INT128__)
+	unsigned __int128 r = a;
+	r *= b;
+	a = static_cast<unsigned long long>(r);
+	b = static_cast<unsigned long long>(r >> 64);
+#else
+	//没有128位整数时，拆分为4个32位 * 32位
+	unsigned long long ha = a >> 32, hb = b >> 32, la = a & 0xFFFFFFFFULL, lb = b & 0xFFFFFFFFULL;
+	unsigned long long rh = ha * hb, rm0 = ha * lb, rm1 = hb * la, rl = la * lb;
+	unsigned long long t = rl + (rm0 << 32);
+	unsigned long long c = (t < rl);
+	unsigned long long lo = t + (rm1 << 32);
+	c += (lo < t);
+	unsigned long long hi = rh + (rm0 >> 32) + (rm1 >> 32) + c;
+	a = lo;
+	b = hi;
+#endif
+}
+
+unsigned long long Hash::_mix(unsigned long long a, unsigned long long b){
+	_mum(a, b);
+	return a ^ b;
+}
+
+//memcpy读入，不要求对齐，编译器会优化为一条指令
+unsigned long long Hash::_read8(const unsigned char* p){
+	unsigned long long v;
+	memcpy(&v, p, 8);
+	return v;
+}
+
+unsigned long long Hash::_read4(const unsigned char* p){
+	unsigned int v;
+	memcpy(&v, p, 4);
+	return v;
+}
+
+unsigned long long Hash::Bytes(const char* s, unsigned int len, unsigned long long seed){
+	const unsigned char* p = reinterpret_cast<const unsigned char*>(s);
+	unsigned long long a = 0;
+	unsigned long long b = 0;
+
+	seed ^= _mix(seed ^ SECRET[0], SECRET[1]);
+
+	if(len <= 16){
+		if(len >= 4){
+			//首尾各读入8个字节（两个重叠的4字节），4~16个字节都不需要循环
+			unsigned int k = (len >> 3) << 2;
+			a = (_read4(p) << 32) | _read4(p + k);
+			b = (_read4(p + len - 4) << 32) | _read4(p + len - 4 - k);
+		}
+		else if(len > 0){
+			a = (static_cast<unsigned long long>(p[0]) << 16) | (static_cast<unsigned long long>(p[len >> 1]) << 8) | p[len - 1];
+		}
+	}
+	else{
+		unsigned int i = len;
+		if(i > 48){
+			//三路相互独立，可以并行执行
+			unsigned long long see1 = seed;
+			unsigned long long see2 = seed;
+			do{
+				seed = _mix(_read8(p) ^ SECRET[1], _read8(p + 8) ^ seed);
+				see1 = _mix(_read8(p + 16) ^ SECRET[2], _read8(p + 24) ^ see1);
+				see2 = _mix(_read8(p + 32) ^ SECRET[3], _read8(p + 40) ^ see2);
+				p += 48;
+				i -= 48;
+			}while(i > 48);
+			seed ^= see1 ^ see2;
+		}
+		while(i > 16){
+			seed = _mix(_read8(p) ^ SECRET[1], _read8(p + 8) ^ seed);
+			p += 16;
+			i -= 16;
+		}
+		//最后16个字节（可能与前面重叠）
+		a = _read8(p + i - 16);
+		b = _read8(p + i - 8);
+	}
+
+	a ^= SECRET[1];
+	b ^= seed;
+	_mum(a, b);
+	return _mix(a ^ SECRET[0] ^ len, b ^ SECRET[1]);
+}
+
+}
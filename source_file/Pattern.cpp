@@ -0,0 +1,183 @@
+#include "./../head_file/Pattern.h"
+#include "./../head_file/StringSearch.h"
+#include <cstring>
+#include "./../head_file/Exception.h"
+
+namespace YzcLib{
+
+Pattern::Pattern(const char* p, Strategy strategy){
+	p = p ? p : "";
+	_init(p, strlen(p), strategy);
+}
+
+Pattern::Pattern(const char* p, unsigned int len, Strategy strategy){
+	if((p == NULL) && (len > 0)){
+		THROW_EXCEPTION(InvalidParameterException, "Parameter p is NULL ...");
+	}
+	_init(p ? p : "", len, strategy);
+}
+
+Pattern::Pattern(const StringView& p, Strategy strategy){
+	_init(p.Data(), p.Length(), strategy);
+}
+
+void Pattern::_init(const char* p, unsigned int len, Strategy strategy){
+	m_pattern = String(p, len);
+	m_pmt = NULL;
+	m_skip = NULL;
+
+	//按子串长度选择，长子串使用HYBRID（Horspool的跳跃 + Two-Way的线性时间保证）
+	if(strategy == AUTO){
+		if(len > StringSearch::SIMD_MAX){
+			strategy = HYBRID;
+		}
+		else if(StringSearch::HasSSE2()){
+			strategy = SIMD;
+		}
+		else{
+			strategy = (len <= KMP_MAX) ? KMP : HYBRID;
+		}
+	}
+	//单个字符没有比memchr更快的方法
+	m_strategy = (len == 1) ? MEMCHR : strategy;
+
+	const char* str = m_pattern.Str();
+	if((m_strategy == KMP) && (len > 0)){
+		m_pmt = new int[len];
+		if(m_pmt == NULL){
+			THROW_EXCEPTION(NotEnoughMemoryException, "No memory to create Pattern object ...");
+		}
+		String::_make_pmt(str, m_pmt, len);
+	}
+	else if((m_strategy == SIMD) && (len > 0)){
+		//过滤失效改用Two-Way时直接使用，不必每次查找都重新分解
+		StringSearch::Factorize(str, len, m_factor);
+	}
+	else if(((m_strategy == HORSPOOL) || (m_strategy == HYBRID)) && (len > 0)){
+		if(m_strategy == HYBRID){
+			StringSearch::Factorize(str, len, m_factor);
+		}
+		m_skip = new unsigned int[256];
+		if(m_skip == NULL){
+			THROW_EXCEPTION(NotEnoughMemoryException, "No memory to create Pattern object ...");
+		}
+		//最后一个字符不参与，否则窗口最后一个字符匹配时右移0位
+		for(unsigned int i = 0; i < 256; i++){
+			m_skip[i] = len;
+		}
+		for(unsigned int i = 0; i + 1 < len; i++){
+			m_skip[static_cast<unsigned char>(str[i])] = len - 1 - i;
+		}
+	}
+}
+
+int Pattern::_kmp(const char* s, unsigned int sl) const{
+	const char* p = m_pattern.Str();
+	unsigned int pl = m_pattern.Length();
+	int rst = -1;
+	unsigned int j = 0;
+
+	for(unsigned int i = 0; i < sl; i++){
+		while(j && p[j] != s[i]){
+			j = m_pmt[j - 1];
+		}
+		if(p[j] == s[i]){
+			j++;
+		}
+		if(j == pl){
+			rst = i - j + 1;
+			break;
+		}
+	}
+	return rst;
+}
+
+/*
+bounded为false时是原始的Horspool，最坏O(n * m)：
+	s = aaaa...，p = a..aba..a，每个窗口最后一个字符都匹配，右移1，每次验证都要比较约m / 2个字节
+bounded为true时（HYBRID）统计验证比较的字节数，超过扫描长度的常数倍时，从当前位置改用Two-Way（分解在构造时已经计算）
+	已经比较的字节数不超过 4 * (i + pl) + 256，Two-Way为线性，总时间O(n + m)
+*/
+int Pattern::_horspool(const char* s, unsigned int sl, bool bounded) const{
+	const char* p = m_pattern.Str();
+	unsigned int pl = m_pattern.Length();
+	char last = p[pl - 1];
+	unsigned long long work = 0;
+	int rst = -1;
+
+	for(unsigned int i = 0; i + pl <= sl; ){
+		char c = s[i + pl - 1];
+		if(c == last){
+			if(!bounded){
+				if(memcmp(s + i, p, pl - 1) == 0){
+					rst = i;
+					break;
+				}
+			}
+			else{
+				unsigned int k = 0;
+				while((k + 1 < pl) && (s[i + k] == p[k])){
+					k++;
+				}
+				if(k + 1 >= pl){
+					rst = i;
+					break;
+				}
+				work += k + 1;
+				if(work > 4 * (static_cast<unsigned long long>(i) + pl) + 256){
+					//i之前的位置都已经确认不匹配
+					rst = StringSearch::TwoWay(s + i, sl - i, p, pl, m_factor);
+					rst = (rst >= 0) ? static_cast<int>(i) + rst : -1;
+					break;
+				}
+			}
+		}
+		i += m_skip[static_cast<unsigned char>(c)];
+	}
+	return rst;
+}
+
+int Pattern::Find(const char* s, unsigned int sl) const{
+	unsigned int pl = m_pattern.Length();
+	int rst = -1;
+
+	if((s != NULL) && (pl > 0) && (sl >= pl)){
+		switch(m_strategy){
+		case KMP:		rst = _kmp(s, sl); break;
+		case HORSPOOL:	rst = _horspool(s, sl, false); break;
+		case HYBRID:	rst = _horspool(s, sl, true); break;
+		case SIMD:		rst = StringSearch::Find(s, sl, m_pattern.Str(), pl, m_factor); break;
+		//MEMCHR由StringSearch完成
+		default:		rst = StringSearch::Find(s, sl, m_pattern.Str(), pl); break;
+		}
+	}
+	return rst;
+}
+
+int Pattern::Find(const StringView& s, unsigned int start) const{
+	int rst = -1;
+	if(start < s.Length()){
+		rst = Find(s.Data() + start, s.Length() - start);
+		rst = (rst >= 0) ? static_cast<int>(start) + rst : -1;
+	}
+	return rst;
+}
+
+Pattern::Strategy Pattern::GetStrategy() const{
+	return m_strategy;
+}
+
+StringView Pattern::View() const{
+	return m_pattern.View();
+}
+
+unsigned int Pattern::Length() const{
+	return m_pattern.Length();
+}
+
+Pattern::~Pattern(){
+	delete[] m_pmt;
+	delete[] m_skip;
+}
+
+}
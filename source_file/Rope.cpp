@@ -0,0 +1,427 @@
+#include "./../head_file/Rope.h"
+#include <cstring>
+#include "./../head_file/Exception.h"
+
+namespace YzcLib{
+
+Rope::Node* Rope::_create(const char* s, unsigned int len){
+	Node* n = new Node();
+	if(n == NULL){
+		THROW_EXCEPTION(NotEnoughMemoryException, "No memory to create Rope node ...");
+	}
+	n->left = NULL;
+	n->right = NULL;
+	n->refs = 1;
+	n->size = len;
+	n->length = len;
+	n->count = 1;
+	memcpy(n->data, s, len);
+	return n;
+}
+
+void Rope::_retain(Node* n){
+	if(n != NULL){
+		n->refs++;
+	}
+}
+
+void Rope::_release(Node* n){
+	if((n != NULL) && (--n->refs == 0)){
+		_release(n->left);
+		_release(n->right);
+		delete n;
+	}
+}
+
+void Rope::_own(Node*& n){
+	if(n->refs > 1){
+		//复制结点本身，子树继续共享
+		Node* m = _create(n->data, n->size);
+		m->left = n->left;
+		m->right = n->right;
+		m->length = n->length;
+		m->count = n->count;
+		_retain(m->left);
+		_retain(m->right);
+
+		n->refs--;
+		n = m;
+	}
+}
+
+unsigned int Rope::_length(const Node* n){
+	return n ? n->length : 0;
+}
+
+unsigned int Rope::_count(const Node* n){
+	return n ? n->count : 0;
+}
+
+void Rope::_update(Node* n){
+	n->length = _length(n->left) + n->size + _length(n->right);
+	n->count = _count(n->left) + 1 + _count(n->right);
+}
+
+Rope::Node* Rope::_build(const char* s, unsigned int len){
+	Node* rst = NULL;
+	if(len > 0){
+		//按块的个数对半分，中间的块作为根
+		unsigned int chunks = (len + CHUNK_SIZE - 1) / CHUNK_SIZE;
+		unsigned int mid = (chunks / 2) * CHUNK_SIZE;
+		unsigned int size = (len - mid < CHUNK_SIZE) ? len - mid : static_cast<unsigned int>(CHUNK_SIZE);
+
+		rst = _create(s + mid, size);
+		try{
+			rst->left = _build(s, mid);
+			rst->right = _build(s + mid + size, len - mid - size);
+		}
+		catch(const Exception& e){
+			_release(rst);
+			throw;
+		}
+		_update(rst);
+	}
+	return rst;
+}
+
+void Rope::_split(Node* n, unsigned int i, Node*& l, Node*& r){
+	if(n == NULL){
+		l = NULL;
+		r = NULL;
+	}
+	else{
+		_own(n);
+		unsigned int ll = _length(n->left);
+
+		if(i <= ll){
+			_split(n->left, i, l, n->left);
+			_update(n);
+			r = n;
+		}
+		else if(i >= ll + n->size){
+			_split(n->right, i - ll - n->size, n->right, r);
+			_update(n);
+			l = n;
+		}
+		else{
+			//i在块的内部，后半部分成为一个新结点，带走右子树
+			unsigned int k = i - ll;
+			Node* m = _create(n->data + k, n->size - k);
+			m->right = n->right;
+			_update(m);
+
+			n->size = k;
+			n->right = NULL;
+			_update(n);
+
+			l = n;
+			r = m;
+		}
+	}
+}
+
+unsigned int Rope::_random(unsigned int n){
+	m_seed ^= m_seed << 13;
+	m_seed ^= m_seed >> 7;
+	m_seed ^= m_seed << 17;
+	return static_cast<unsigned int>(m_seed % n);
+}
+
+Rope::Node* Rope::_merge(Node* a, Node* b){
+	Node* rst = NULL;
+	if(a == NULL){
+		rst = b;
+	}
+	else if(b == NULL){
+		rst = a;
+	}
+	else if(_random(a->count + b->count) < a->count){
+		_own(a);
+		a->right = _merge(a->right, b);
+		_update(a);
+		rst = a;
+	}
+	else{
+		_own(b);
+		b->left = _merge(a, b->left);
+		_update(b);
+		rst = b;
+	}
+	return rst;
+}
+
+bool Rope::_insert_local(unsigned int i, const char* s, unsigned int len){
+	//先只读地找到i所在的块，空间足够时再沿路径复制、修改
+	const Node* n = m_root;
+	unsigned int k = i;
+	while(n != NULL){
+		unsigned int ll = _length(n->left);
+		if(k < ll){
+			n = n->left;
+		}
+		else if(k <= ll + n->size){
+			break;
+		}
+		else{
+			k -= ll + n->size;
+			n = n->right;
+		}
+	}
+
+	bool rst = (n != NULL) && (n->size + len <= CHUNK_SIZE);
+	if(rst){
+		Node** link = &m_root;
+		k = i;
+		while(true){
+			_own(*link);
+			Node* t = *link;
+			unsigned int ll = _length(t->left);
+			t->length += len;
+
+			if(k < ll){
+				link = &t->left;
+			}
+			else if(k <= ll + t->size){
+				k -= ll;
+				memmove(t->data + k + len, t->data + k, t->size - k);
+				memcpy(t->data + k, s, len);
+				t->size += len;
+				break;
+			}
+			else{
+				k -= ll + t->size;
+				link = &t->right;
+			}
+		}
+	}
+	return rst;
+}
+
+bool Rope::_remove_local(unsigned int i, unsigned int len){
+	const Node* n = m_root;
+	unsigned int k = i;
+	while(n != NULL){
+		unsigned int ll = _length(n->left);
+		if(k < ll){
+			n = n->left;
+		}
+		else if(k < ll + n->size){
+			k -= ll;
+			break;
+		}
+		else{
+			k -= ll + n->size;
+			n = n->right;
+		}
+	}
+
+	//整个块都被删除时需要去掉结点，交给split处理
+	bool rst = (n != NULL) && (k + len <= n->size) && (len < n->size);
+	if(rst){
+		Node** link = &m_root;
+		k = i;
+		while(true){
+			_own(*link);
+			Node* t = *link;
+			unsigned int ll = _length(t->left);
+			t->length -= len;
+
+			if(k < ll){
+				link = &t->left;
+			}
+			else if(k < ll + t->size){
+				k -= ll;
+				memmove(t->data + k, t->data + k + len, t->size - k - len);
+				t->size -= len;
+				break;
+			}
+			else{
+				k -= ll + t->size;
+				link = &t->right;
+			}
+		}
+	}
+	return rst;
+}
+
+void Rope::_insert(unsigned int i, Node* t){
+	Node* l = NULL;
+	Node* r = NULL;
+	_split(m_root, i, l, r);
+	m_root = _merge(_merge(l, t), r);
+}
+
+void Rope::_copy(const Node* n, String& s){
+	if(n != NULL){
+		_copy(n->left, s);
+		s._append(n->data, n->size);
+		_copy(n->right, s);
+	}
+}
+
+void Rope::_write(const Node* n, ostream& out){
+	if(n != NULL){
+		_write(n->left, out);
+		out.write(n->data, n->size);
+		_write(n->right, out);
+	}
+}
+
+Rope::Rope(){
+	m_root = NULL;
+	m_seed = 0x9E3779B97F4A7C15ULL;
+}
+
+Rope::Rope(const StringView& s){
+	m_seed = 0x9E3779B97F4A7C15ULL;
+	m_root = _build(s.Data(), s.Length());
+}
+
+Rope::Rope(const Rope& r){
+	m_seed = r.m_seed;
+	m_root = r.m_root;
+	_retain(m_root);
+}
+
+Rope& Rope::operator = (const Rope& r){
+	if(this != &r){
+		//先增加引用，r与自身共享结点时也不会被提前释放
+		_retain(r.m_root);
+		_release(m_root);
+		m_root = r.m_root;
+	}
+	return *this;
+}
+
+unsigned int Rope::Length() const{
+	return _length(m_root);
+}
+
+unsigned int Rope::Chunks() const{
+	return _count(m_root);
+}
+
+char Rope::operator [](unsigned int i) const{
+	if(i < Length()){
+		const Node* n = m_root;
+		while(true){
+			unsigned int ll = _length(n->left);
+			if(i < ll){
+				n = n->left;
+			}
+			else if(i < ll + n->size){
+				return n->data[i - ll];
+			}
+			else{
+				i -= ll + n->size;
+				n = n->right;
+			}
+		}
+	}
+	else{
+		THROW_EXCEPTION(IndexOutOfBoundsException, "Parameter i is invalid ...");
+	}
+}
+
+Rope& Rope::Insert(int i, const StringView& s){
+	if((i >= 0) && (static_cast<unsigned int>(i) <= Length())){
+		unsigned int len = s.Length();
+		if((len > 0) && !((len <= CHUNK_SIZE) && _insert_local(i, s.Data(), len))){
+			_insert(i, _build(s.Data(), len));
+		}
+	}
+	else{
+		THROW_EXCEPTION(IndexOutOfBoundsException, "Parameter i is invalid ...");
+	}
+	return *this;
+}
+
+Rope& Rope::Insert(int i, const Rope& r){
+	if((i >= 0) && (static_cast<unsigned int>(i) <= Length())){
+		//r可能就是自身，先增加引用，split时会复制共享的路径
+		Node* t = r.m_root;
+		_retain(t);
+		_insert(i, t);
+	}
+	else{
+		THROW_EXCEPTION(IndexOutOfBoundsException, "Parameter i is invalid ...");
+	}
+	return *this;
+}
+
+Rope& Rope::Remove(int i, unsigned int len){
+	unsigned int length = Length();
+	if((i >= 0) && (static_cast<unsigned int>(i) < length)){
+		len = (len < length - i) ? len : length - i;
+		if((len > 0) && !_remove_local(i, len)){
+			Node* l = NULL;
+			Node* m = NULL;
+			Node* r = NULL;
+			_split(m_root, i, l, r);
+			_split(r, len, m, r);
+			_release(m);
+			m_root = _merge(l, r);
+		}
+	}
+	return *this;
+}
+
+Rope Rope::Sub(int i, unsigned int len) const{
+	unsigned int length = Length();
+	if((i >= 0) && (static_cast<unsigned int>(i) < length)){
+		len = (len < length - i) ? len : length - i;
+
+		//在共享的树上split，只复制两条路径，自身不变
+		Node* l = NULL;
+		Node* m = NULL;
+		Node* r = NULL;
+		_retain(m_root);
+		_split(m_root, i, l, r);
+		_split(r, len, m, r);
+		_release(l);
+		_release(r);
+
+		Rope rst;
+		rst.m_root = m;
+		return rst;
+	}
+	else{
+		THROW_EXCEPTION(IndexOutOfBoundsException, "Parameter i is invalid ...");
+	}
+}
+
+Rope& Rope::Append(const StringView& s){
+	return Insert(Length(), s);
+}
+
+Rope& Rope::Append(const Rope& r){
+	return Insert(Length(), r);
+}
+
+Rope& Rope::operator += (const Rope& r){
+	return Append(r);
+}
+
+Rope Rope::operator + (const Rope& r) const{
+	Rope rst(*this);
+	rst.Append(r);
+	return rst;
+}
+
+String Rope::ToString() const{
+	String rst;
+	rst._reserve(Length());
+	_copy(m_root, rst);
+	return rst;
+}
+
+ostream& operator <<(ostream& out, const Rope& r){
+	Rope::_write(r.m_root, out);
+	return out;
+}
+
+Rope::~Rope(){
+	_release(m_root);
+}
+
+}
@@ -0,0 +1,382 @@
+#include "./../head_file/Data_structure.h"
+#include <cstdlib>
+#include <cstring>
+#include <cstdio>
+#include <chrono>
+
+/*
+Sort性能测试程序
+
+编译：
+	g++ -O2 -std=c++11 source_file/SortBenchmark.cpp source_file/Object.cpp source_file/Exception.cpp source_file/String.cpp source_file/StringBuilder.cpp source_file/StringView.cpp source_file/StringSearch.cpp source_file/Pattern.cpp source_file/StringTokenizer.cpp source_file/Hash.cpp -o sort_bench
+
+用法：
+	sort_bench [--max N] [--quadratic-max N] [--repeat R] [--algo NAME] [--dist NAME] [--no-count]
+
+	--max			最大规模，规模从100开始每次乘10，直到N（默认1000000，最大100000000）
+	--quadratic-max	O(n^2)算法的最大规模（默认100000），快速排序在非随机输入上同样受此限制（递归深度为O(n)）
+	--repeat		每个规模重复计时的次数，取最小值（默认3）
+	--algo			只测试指定的算法
+	--dist			只测试指定的输入分布
+	--no-count		不统计比较次数和移动次数（统计需要额外执行一次）
+
+输出（CSV，第一行为表头，便于脚本处理）：
+	algorithm,distribution,n,ns_per_element,comparisons,moves,sorted
+
+	comparisons,moves通过Counted<T>包装类型统计，moves包含拷贝构造和赋值
+	--no-count时comparisons,moves输出-1
+	sorted为排序结果的校验，1表示结果有序
+
+输入分布：
+	random		均匀随机
+	sorted		已经有序
+	reverse		逆序
+	sawtooth	锯齿，每段长度为sqrt(n)的升序段
+	few_unique	只有16种不同的值
+	organ_pipe	先升序后降序
+	strings		随机字符串（String类型，长度8~16）
+*/
+
+using namespace YzcLib;
+
+namespace{
+
+//统计比较和移动次数的包装类型
+template<typename T>
+struct Counted: public Object{
+	T value;
+
+	static unsigned long long s_cmp;
+	static unsigned long long s_move;
+
+	Counted(){}
+	Counted(const T& v):value(v){}
+	Counted(const Counted<T>& obj):Object(), value(obj.value){
+		s_move++;
+	}
+	Counted<T>& operator = (const Counted<T>& obj){
+		s_move++;
+		value = obj.value;
+		return *this;
+	}
+
+	bool operator < (const Counted<T>& obj) const{ s_cmp++; return value < obj.value; }
+	bool operator > (const Counted<T>& obj) const{ s_cmp++; return value > obj.value; }
+	bool operator <= (const Counted<T>& obj) const{ s_cmp++; return value <= obj.value; }
+	bool operator >= (const Counted<T>& obj) const{ s_cmp++; return value >= obj.value; }
+};
+
+template<typename T> unsigned long long Counted<T>::s_cmp = 0;
+template<typename T> unsigned long long Counted<T>::s_move = 0;
+
+enum Algorithm{
+	INSERTION,
+	SELECTION,
+	BUBBLE,
+	SHELL,
+	MERGE,
+	QUICK,
+	KWAY,
+	INDEX,
+	ALGORITHM_COUNT
+};
+
+const char* ALGORITHM_NAME[ALGORITHM_COUNT] = {
+	"Insertion_Sort",
+	"Selection_Sort",
+	"Bubble_Sort",
+	"Shell_Sort",
+	"Merge_Sort",
+	"Quick_Sort",
+	"KWay_Merge",
+	"Index_Sort"
+};
+
+enum Distribution{
+	RANDOM,
+	SORTED,
+	REVERSE,
+	SAWTOOTH,
+	FEW_UNIQUE,
+	ORGAN_PIPE,
+	STRINGS,
+	DISTRIBUTION_COUNT
+};
+
+const char* DISTRIBUTION_NAME[DISTRIBUTION_COUNT] = {
+	"random",
+	"sorted",
+	"reverse",
+	"sawtooth",
+	"few_unique",
+	"organ_pipe",
+	"strings"
+};
+
+//xorshift随机数，保证每次运行的输入相同
+unsigned long long g_seed = 88172645463325252ULL;
+
+unsigned long long Random(){
+	g_seed ^= g_seed << 13;
+	g_seed ^= g_seed >> 7;
+	g_seed ^= g_seed << 17;
+	return g_seed;
+}
+
+void Generate(int* a, unsigned int n, Distribution d){
+	unsigned int run = 1;
+	while(run * run < n) run++;
+
+	for(unsigned int i = 0; i < n; i++){
+		switch(d){
+		case SORTED:		a[i] = i; break;
+		case REVERSE:		a[i] = n - i; break;
+		case SAWTOOTH:		a[i] = i % run; break;
+		case FEW_UNIQUE:	a[i] = Random() % 16; break;
+		case ORGAN_PIPE:	a[i] = (i < n / 2) ? i : n - i; break;
+		default:			a[i] = static_cast<int>(Random() & 0x7FFFFFFF); break;
+		}
+	}
+}
+
+void Generate(String* a, unsigned int n){
+	char buf[17];
+	for(unsigned int i = 0; i < n; i++){
+		unsigned int len = 8 + Random() % 9;
+		for(unsigned int j = 0; j < len; j++){
+			buf[j] = 'a' + Random() % 26;
+		}
+		buf[len] = '\0';
+		a[i] = buf;
+	}
+}
+
+/*
+KWay_Merge不是排序算法，这里将序列分为16段，分别用Merge_Sort排序后再进行多路归并
+*/
+template<typename T>
+void KWay_Sort(T a[], unsigned int n){
+	const unsigned int K = 16;
+	DynamicArray<T> run[K];
+	Array<T>* src[K];
+
+	for(unsigned int i = 0, begin = 0; i < K; i++){
+		unsigned int end = (n / K) * (i + 1) + ((i + 1 == K) ? n % K : 0);
+		run[i].resize(end - begin);
+		for(unsigned int j = begin; j < end; j++){
+			run[i][j - begin] = a[j];
+		}
+		Sort::Merge_Sort(run[i]);
+		src[i] = &run[i];
+		begin = end;
+	}
+
+	DynamicArray<T> dst(n);
+	Sort::KWay_Merge(src, K, dst);
+	for(unsigned int i = 0; i < n; i++){
+		a[i] = dst[i];
+	}
+}
+
+/*
+Index_Sort只对下标排序，再通过Permute将每个元素最多移动一次
+*/
+template<typename T>
+void Index_Sort(T a[], unsigned int n){
+	DynamicArray<unsigned int> idx(n);
+	Sort::Index_Sort(a, n, idx);
+	Sort::Permute(a, n, idx);
+}
+
+template<typename T>
+void Run(Algorithm algo, T a[], unsigned int n){
+	switch(algo){
+	case INSERTION:	Sort::Insertion_Sort(a, n); break;
+	case SELECTION:	Sort::Selection_Sort(a, n); break;
+	case BUBBLE:	Sort::Bubble_Sort(a, n); break;
+	case SHELL:		Sort::Shell_Sort(a, n); break;
+	case MERGE:		Sort::Merge_Sort(a, n); break;
+	case QUICK:		Sort::Quick_Sort(a, n); break;
+	case KWAY:		KWay_Sort(a, n); break;
+	case INDEX:		Index_Sort(a, n); break;
+	default:		break;
+	}
+}
+
+template<typename T>
+bool IsSorted(const T a[], unsigned int n){
+	bool rst = true;
+	for(unsigned int i = 1; rst && i < n; i++){
+		rst = !(a[i] < a[i - 1]);
+	}
+	return rst;
+}
+
+//最好的一次计时，单位ns/element
+template<typename T, typename S>
+double Time(Algorithm algo, const S src[], unsigned int n, unsigned int repeat, bool& sorted){
+	double best = -1;
+	T* a = new T[n];
+	if(a == NULL){
+		THROW_EXCEPTION(NotEnoughMemoryException, "No memory to create benchmark input...");
+	}
+
+	for(unsigned int r = 0; r < repeat; r++){
+		for(unsigned int i = 0; i < n; i++){
+			a[i] = src[i];
+		}
+
+		std::chrono::steady_clock::time_point begin = std::chrono::steady_clock::now();
+		Run(algo, a, n);
+		std::chrono::steady_clock::time_point end = std::chrono::steady_clock::now();
+
+		double ns = std::chrono::duration<double, std::nano>(end - begin).count() / (n ? n : 1);
+		if(best < 0 || ns < best) best = ns;
+	}
+
+	sorted = IsSorted(a, n);
+	delete[] a;
+	return best;
+}
+
+//统计一次完整排序的比较次数和移动次数
+template<typename S>
+void Count(Algorithm algo, const S src[], unsigned int n, long long& cmp, long long& move){
+	Counted<S>* a = new Counted<S>[n];
+	if(a == NULL){
+		THROW_EXCEPTION(NotEnoughMemoryException, "No memory to create benchmark input...");
+	}
+	for(unsigned int i = 0; i < n; i++){
+		a[i].value = src[i];
+	}
+
+	Counted<S>::s_cmp = 0;
+	Counted<S>::s_move = 0;
+	Run(algo, a, n);
+	cmp = Counted<S>::s_cmp;
+	move = Counted<S>::s_move;
+
+	delete[] a;
+}
+
+//O(n^2)的情况受quadratic-max限制
+bool IsQuadratic(Algorithm algo, Distribution d){
+	return (algo == INSERTION) || (algo == SELECTION) || (algo == BUBBLE) || \
+		   ((algo == QUICK) && (d != RANDOM) && (d != STRINGS));
+}
+
+int Find(const char* name, const char* const table[], int len){
+	int rst = -1;
+	for(int i = 0; i < len; i++){
+		if(strcmp(name, table[i]) == 0){
+			rst = i;
+			break;
+		}
+	}
+	return rst;
+}
+
+//名字拼错时列出所有合法的名字，而不是运行全部组合
+void Unknown(const char* kind, const char* name, const char* const table[], int len){
+	fprintf(stderr, "unknown %s: %s\nvalid %ss:", kind, name, kind);
+	for(int i = 0; i < len; i++){
+		fprintf(stderr, " %s", table[i]);
+	}
+	fprintf(stderr, "\n");
+}
+
+}
+
+int main(int argc, char* argv[]){
+	unsigned long max = 1000000;
+	unsigned long quadratic = 100000;
+	unsigned int repeat = 3;
+	int onlyAlgo = -1;
+	int onlyDist = -1;
+	bool count = true;
+
+	for(int i = 1; i < argc; i++){
+		if(strcmp(argv[i], "--max") == 0 && i + 1 < argc){
+			max = strtoul(argv[++i], NULL, 10);
+		}
+		else if(strcmp(argv[i], "--quadratic-max") == 0 && i + 1 < argc){
+			quadratic = strtoul(argv[++i], NULL, 10);
+		}
+		else if(strcmp(argv[i], "--repeat") == 0 && i + 1 < argc){
+			repeat = strtoul(argv[++i], NULL, 10);
+		}
+		else if(strcmp(argv[i], "--algo") == 0 && i + 1 < argc){
+			onlyAlgo = Find(argv[++i], ALGORITHM_NAME, ALGORITHM_COUNT);
+			if(onlyAlgo < 0){
+				Unknown("algorithm", argv[i], ALGORITHM_NAME, ALGORITHM_COUNT);
+				return 1;
+			}
+		}
+		else if(strcmp(argv[i], "--dist") == 0 && i + 1 < argc){
+			onlyDist = Find(argv[++i], DISTRIBUTION_NAME, DISTRIBUTION_COUNT);
+			if(onlyDist < 0){
+				Unknown("distribution", argv[i], DISTRIBUTION_NAME, DISTRIBUTION_COUNT);
+				return 1;
+			}
+		}
+		else if(strcmp(argv[i], "--no-count") == 0){
+			count = false;
+		}
+		else{
+			fprintf(stderr, "unknown option: %s\n", argv[i]);
+			return 1;
+		}
+	}
+
+	max = (max > 100000000) ? 100000000 : max;
+	repeat = (repeat == 0) ? 1 : repeat;
+
+	printf("algorithm,distribution,n,ns_per_element,comparisons,moves,sorted\n");
+
+	for(int d = 0; d < DISTRIBUTION_COUNT; d++){
+		if(onlyDist >= 0 && onlyDist != d) continue;
+
+		for(unsigned long n = 100; n <= max; n *= 10){
+			//同一个规模的输入只生成一次，所有算法使用相同的输入
+			int* ia = NULL;
+			String* sa = NULL;
+
+			if(d == STRINGS){
+				sa = new String[n];
+				if(sa) Generate(sa, n);
+			}
+			else{
+				ia = new int[n];
+				Generate(ia, n, static_cast<Distribution>(d));
+			}
+
+			for(int a = 0; a < ALGORITHM_COUNT; a++){
+				Algorithm algo = static_cast<Algorithm>(a);
+				if(onlyAlgo >= 0 && onlyAlgo != a) continue;
+				if(IsQuadratic(algo, static_cast<Distribution>(d)) && n > quadratic) continue;
+
+				bool sorted = false;
+				long long cmp = -1;
+				long long move = -1;
+				double ns = 0;
+
+				if(d == STRINGS){
+					ns = Time<String>(algo, sa, n, repeat, sorted);
+					if(count) Count(algo, sa, n, cmp, move);
+				}
+				else{
+					ns = Time<int>(algo, ia, n, repeat, sorted);
+					if(count) Count(algo, ia, n, cmp, move);
+				}
+
+				printf("%s,%s,%lu,%.3f,%lld,%lld,%d\n", ALGORITHM_NAME[a], DISTRIBUTION_NAME[d], n, ns, cmp, move, sorted ? 1 : 0);
+				fflush(stdout);
+			}
+
+			delete[] ia;
+			delete[] sa;
+		}
+	}
+
+	return 0;
+}
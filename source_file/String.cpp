@@ -1,9 +1,15 @@
 
 #include "./../head_file/String.h"
+#include "./../head_file/StringSearch.h"
+#include "./../head_file/Pattern.h"
+#include "./../head_file/StringTokenizer.h"
+#include "./../head_file/Hash.h"
 //malloc,free
 #include <cstdlib>
 
 #include <cstring>
+//isspace
+#include <cctype>
 #include "./../head_file/Exception.h"
 
 
@@ -11,12 +17,20 @@
 namespace YzcLib{
 
 void String::_init(const char* s){
-	//使用了strdup意味着使用了malloc，也就是说在string类中，不会有new delete，而使用malloc和free
-	//字符串类中的字符串都是分布在堆空间上的	
-	str = strdup(s);
+	_init(s, strlen(s));
+}
+
+void String::_init(const char* s, unsigned int len){
+	//使用了malloc，也就是说在string类中，不会有new delete，而使用malloc和free
+	//短字符串存放在内置缓冲区中，不访问堆空间
+	str = _alloc(len);
 
 	if(str != NULL ){
-		length = strlen(str);
+		memcpy(str, s, len);
+		str[len] = '\0';
+		length = len;
+		m_capacity = _is_local() ? static_cast<unsigned int>(SSO_SIZE) : len;
+		m_hash = 0;
 	}
 	else{
 		THROW_EXCEPTION(NotEnoughMemoryException,"No memory to create String object ...");
@@ -24,6 +38,95 @@ void String::_init(const char* s){
 
 }
 
+bool String::_is_local() const{
+	return (str == m_sso);
+}
+
+char* String::_alloc(unsigned int len){
+	return (len <= SSO_SIZE) ? m_sso : reinterpret_cast<char*>(malloc(len + 1));
+}
+
+void String::_release(){
+	if(!_is_local()){
+		free(str);
+	}
+	str = m_sso;
+	m_capacity = SSO_SIZE;
+}
+
+/*
+s可能指向自身的内容（如 s = s.Str() + 1）
+	短串：内置缓冲区使用memmove，允许重叠
+	长串：当前堆空间足够时在原有空间中memmove，否则先拷贝到新的堆空间，再释放原来的空间
+*/
+void String::_assign(const char* s, unsigned int len){
+	m_hash = 0;
+	if(len <= SSO_SIZE){
+		memmove(m_sso, s, len);
+		m_sso[len] = '\0';
+		_release();
+	}
+	else if(!_is_local() && len <= m_capacity){
+		memmove(str, s, len);
+		str[len] = '\0';
+	}
+	else{
+		char* new_str = reinterpret_cast<char*>(malloc(len + 1));
+
+		if(new_str){
+			memcpy(new_str, s, len);
+			new_str[len] = '\0';
+			//malloc and free function never throw the exception
+			_release();
+			str = new_str;
+			m_capacity = len;
+		}
+		else{
+			THROW_EXCEPTION(NotEnoughMemoryException, "No memory to assign new String value ...");
+		}
+	}
+	length = len;
+}
+
+/*
+容量按照几何级数增长（至少翻倍），保证连续追加n个字符的总开销为O(n)
+已有的内容（包括'\0'）会拷贝到新的空间中
+*/
+void String::_reserve(unsigned int capacity){
+	if(capacity > m_capacity){
+		unsigned int new_capacity = (m_capacity * 2 > capacity) ? m_capacity * 2 : capacity;
+		char* new_str = reinterpret_cast<char*>(malloc(new_capacity + 1));
+
+		if(new_str){
+			memcpy(new_str, str, length + 1);
+			_release();
+			str = new_str;
+			m_capacity = new_capacity;
+		}
+		else{
+			THROW_EXCEPTION(NotEnoughMemoryException, "No memory to enlarge String object ...");
+		}
+	}
+}
+
+/*
+在尾部追加len个字符，s可以指向自身的内容
+扩容会释放原来的空间，因此先记录s在自身中的偏移，扩容后重新定位
+*/
+void String::_append(const char* s, unsigned int len){
+	if(len > 0){
+		m_hash = 0;
+		bool self = (s >= str) && (s <= str + length);
+		unsigned int offset = self ? (s - str) : 0;
+
+		_reserve(length + len);
+
+		memmove(str + length, self ? (str + offset) : s, len);
+		length += len;
+		str[length] = '\0';
+	}
+}
+
 String::String(){
 	_init("");
 }
@@ -31,8 +134,13 @@ String::String(){
 String::String(const char* s){
 	_init(s?s:"");
 }
+String::String(const char* s, unsigned int len){
+	_init(s?s:"", s?len:0);
+}
 String::String(const String& s){
-	_init(s.str);
+	_init(s.str, s.length);
+	//内容相同，哈希值可以直接拷贝
+	m_hash = s.m_hash;
 }
 String::String(const char c){
 
@@ -50,6 +158,14 @@ unsigned int String::Length()const{
 	return length;
 }
 
+unsigned int String::Capacity() const{
+	return m_capacity;
+}
+
+void String::Reserve(unsigned int capacity){
+	_reserve(capacity);
+}
+
 /*
 友元函数，不能加类作用域限制，写成
 ostream& String::operator <<(ostream& out, String& s)
@@ -60,12 +176,32 @@ cout<<(s - "cde"),(s - "cde")没有后续操作的话会被默认为一个const
 但是如果有后续非const的操作，(s - "cde").Insert(0, "yzc")，(s - "cde")被视为非const的
 */
 ostream& operator <<(ostream& out, const String& s){
-	out<<s.str;
+	//按长度输出，内容中的'\0'也会输出
+	out.write(s.str, s.length);
 	return out;
 }
 
-istream& operator >>(istream& in, const String& s){
-	in>>s.str;
+/*
+读入一个以空白字符分隔的单词
+原来直接读入s.str，既不检查空间大小，也不更新length
+现在逐个字符追加，容量不够时自动扩容
+*/
+istream& operator >>(istream& in, String& s){
+	s._assign("", 0);
+
+	istream::sentry ok(in);
+	if(ok){
+		int c = in.peek();
+		while((c != EOF) && !isspace(c)){
+			char ch = static_cast<char>(c);
+			s._append(&ch, 1);
+			in.get();
+			c = in.peek();
+		}
+		if(c == EOF){
+			in.setstate(ios::eofbit);
+		}
+	}
 	return in;
 }
 /*
@@ -79,23 +215,33 @@ istream& operator >>(istream& in, const String& s){
 */
 
 /*
-字符串所有的比较操作都是基于strcmp进行的。
-strcmp: This function starts comparing the first character of each string. If they are equal to each other, it continues with the following pairs until the characters differ or until a terminating null-character is reached.
-
-int strcmp(const char *str1, const char *str2)
-	str1 − This is the first string to be compared.
-	str2 − This is the second string to be compared.
-Return Value:
-	if Return value < 0 then it indicates str1 is less than str2.
-	if Return value > 0 then it indicates str2 is less than str1.
-	if Return value = 0 then it indicates str1 is equal to str2.
+字符串的比较操作
+	原来基于strcmp，逐个字节比较直到遇到不同的字符或者'\0'，没有利用已经记录的长度，并且内容中不能有'\0'
+	现在基于长度和memcmp：
+		相等：长度不同一定不相等，直接返回；长度相同时memcmp（c库中已经向量化）
+		大小：memcmp比较公共长度部分，公共部分相同时短的较小（与strcmp的结果一致）
+	与const char*比较时，先strlen得到长度
 */
+int String::_compare(const char* s, unsigned int len) const{
+	unsigned int n = (length < len) ? length : len;
+	int rst = memcmp(str, s, n);
+
+	if(rst == 0){
+		rst = (length < len) ? -1 : ((length > len) ? 1 : 0);
+	}
+	return rst;
+}
+
+bool String::_equal(const char* s, unsigned int len) const{
+	return (length == len) && (memcmp(str, s, len) == 0);
+}
 
 bool String::operator == (const String& s) const{
-	return (strcmp(str, s.Str()) == 0);
+	return _equal(s.str, s.length);
 }
 bool String::operator == (const char* s) const{
-	return (strcmp(str, (s? s : "")) == 0);
+	s = s? s : "";
+	return _equal(s, strlen(s));
 }
 
 bool String::operator != (const String& s) const{
@@ -106,61 +252,67 @@ bool String::operator != (const char* s) const{
 }
 
 bool String::operator > (const String& s) const{
-	return (strcmp(str, s.Str()) > 0);
+	return _compare(s.str, s.length) > 0;
 }
 bool String::operator > (const char* s) const{
-	return (strcmp(str, (s? s : "")) > 0);
+	s = s? s : "";
+	return _compare(s, strlen(s)) > 0;
 }
 
 bool String::operator < (const String& s) const{
-	return (strcmp(str, s.Str()) < 0);
+	return _compare(s.str, s.length) < 0;
 }
 bool String::operator < (const char* s) const{
-	return (strcmp(str, (s? s : "")) < 0);
+	s = s? s : "";
+	return _compare(s, strlen(s)) < 0;
 }
 
 bool String::operator >= (const String& s) const{
-	return (strcmp(str, s.Str()) >= 0);
+	return _compare(s.str, s.length) >= 0;
 }
 bool String::operator >= (const char* s) const{
-	return (strcmp(str, (s? s : "")) >= 0);
+	s = s? s : "";
+	return _compare(s, strlen(s)) >= 0;
 }
 
 bool String::operator <= (const String& s) const{
-	return (strcmp(str, s.Str()) <= 0);
+	return _compare(s.str, s.length) <= 0;
 }
 bool String::operator <= (const char* s) const{
-	return (strcmp(str, (s? s : "")) <= 0);
+	s = s? s : "";
+	return _compare(s, strlen(s)) <= 0;
 }
 
 
-//返回值为引用，方便链式操作
-//为了方便复用，在operator + (const String& s) const内部调用operator + (const char* s)
+//为了方便复用，两个版本都调用_concat，String版本直接使用记录的长度，不需要strlen
 String String::operator + (const String& s) const{
-	return *this + s.Str();
+	return _concat(s.str, s.length);
 }
 
 
 String String::operator + (const char* s) const{
+	s = s? s : "";
+	return _concat(s, strlen(s));
+}
+
+String String::_concat(const char* s, unsigned int len) const{
 	//string类型不能是char*，必须是const char*.因为字符串都是const char*类型，根据左数右指，指针所指向数值是不能变的，如果string 类型是char*,复制之后指针所指向内容变得可变了
 
 	//在String作用域内部，不受private，protected限制。private和protected主要是限制外部作用域的。因此在String作用域内部申请的变量，可以直接访问其私有成员
 	String rst;
 
-	unsigned int len = strlen(s? s : "");
 	//const char*指针只能赋值给被const修饰的指针，确保指针所指数值不必那，但是被赋值的指针不需要有const属性
-	char* new_str = reinterpret_cast<char*>(malloc(length + len + 1));
+	//rst是新构造的空串，内置缓冲区中没有需要保留的内容
+	char* new_str = rst._alloc(length + len);
 
 	if(new_str){
-		strcpy(new_str, str);
-		strcat(new_str, s? s : "");
-
-		//malloc and free function never throw the exception
-		//因此可以将free放在状态更新的前边，依旧满足异常安全
-		free(rst.str);
+		memcpy(new_str, str, length);
+		memcpy(new_str + length, s, len);
+		new_str[length + len] = '\0';
 
 		rst.str = new_str;
-		rst.length = strlen(rst.str);
+		rst.length = length + len;
+		rst.m_capacity = rst._is_local() ? static_cast<unsigned int>(SSO_SIZE) : rst.length;
 		
 	}
 	else{
@@ -170,48 +322,46 @@ String String::operator + (const char* s) const{
 }
 
 
-//必须要*this = ，不然this的值不会发生改变
+/*
++=直接在尾部追加，不再构造临时对象
+容量不够时按照几何级数扩容，连续追加是均摊O(1)的
+*/
 String& String::operator += (const String& s){
-	return (*this = *this + s.str);
+	_append(s.str, s.length);
+	return *this;
 }
 String& String::operator += (const char* s) {
-	return (*this = *this + s);
+	if(s != NULL){
+		_append(s, strlen(s));
+	}
+	return *this;
 }
 
 //返回s.str，而不是s.Str(),因为String内部可以直接访问private属性的成员
 String& String::operator = (const String s){
-	return (*this = s.str);
+	//s是拷贝，不会与自身重叠，按长度赋值，保留内容中的'\0'
+	_assign(s.str, s.length);
+	return *this;
 }
 
 String& String::operator = (const char* s){
 	//检测成员str是否和s相等，若相等则无需赋值
 	if( str != s){
-
-		char* new_str = strdup(s? s : "");
-
-		if(new_str){
-
-			free(str);
-
-			str = new_str;
-
-			length = strlen(str);
-
-		}
-		else{
-			THROW_EXCEPTION(NotEnoughMemoryException, "No memory to assign new String value ...");
-		}
+		s = s? s : "";
+		_assign(s, strlen(s));
 	}
 	return *this;
 }
 
 String::~String(){
-	free(str);
+	_release();
 }
 
 
 char& String::operator [](unsigned int i){
 	if( i < length){
+		//返回的引用可能被修改，缓存的哈希值不再可信
+		m_hash = 0;
 		return str[i];
 	}
 	else{
@@ -220,74 +370,64 @@ char& String::operator [](unsigned int i){
 }
 
 char String::operator [](unsigned int i) const{
-	//可以通过强制类型转换到非const类，调用类中的一些非const成员。当转换到非const成员之后，对于该成员将不会进行const的性质检测（不改变成员的值）
-	return const_cast<String&>(*this)[i];
+	//不能复用非const版本，否则每次读取都会清除缓存的哈希值
+	if( i < length){
+		return str[i];
+	}
+	else{
+		THROW_EXCEPTION(IndexOutOfBoundsException, "Parameter is invalid ...");
+	}
 }
 
 
 
-bool String::_equal(const char* s1, const char* s2) const{
-	bool rst = false;
-	unsigned int i = 0;
-	while(1){
-		if(s2[i] == '\0'){
-			rst = true;
-			break;
-		}
-		else if(s1[i] == '\0' || s2[i] != s1[i]){
-			break;
-		}
-
-		i++;
-	}
-	return rst;
-}
-
 bool String::StartWith(const char* s) const{
-	bool rst = (s != NULL);
-	if(rst){
-		rst = _equal(str, s);
-	}
-	return rst;
+	return (s != NULL) && StartWith(StringView(s));
 }
 bool String::StartWith(const String& s) const{
-	return StartWith(s.str);
+	return StartWith(s.View());
 }
 bool String::EndOf(const char* s) const{
-	bool rst = (s != NULL);
-	if(rst){
-		unsigned int len = strlen(s);
-		rst = (len <= length)&&_equal(str + length - len, s);
-	}
-	return rst;
+	return (s != NULL) && EndOf(StringView(s));
 }
 bool String::EndOf(const String& s) const{
-	return EndOf(s.str);
+	return EndOf(s.View());
 }	
+bool String::StartWith(const StringView& s) const{
+	return (s.Length() <= length) && (memcmp(str, s.Data(), s.Length()) == 0);
+}
+bool String::EndOf(const StringView& s) const{
+	return (s.Length() <= length) && (memcmp(str + length - s.Length(), s.Data(), s.Length()) == 0);
+}
 
 //在指定位置插入字符串
 //需要进行位置合法性检测，不合法抛异常
 //需要进行指针的非空检测，若为空，不做任何操作
 //i可以理解为第几个位置插入，也可以理解为，插入的位置前边有几个元素，方便变成。
 String& String::Insert(int i, const char* s){
+	return _insert(i, s, s? strlen(s) : 0);
+}
+
+String& String::Insert(int i, const String& s){
+	return _insert(i, s.str, s.length);
+}
+
+String& String::_insert(int i, const char* s, unsigned int len){
 	//插入操作取值范围为[0, length],0代表在最前边插入，length代表在尾部插入
 	if((i >= 0)&&( i <= length)){
-		if((s != NULL)&&(*s != '\0')){
-			int len = strlen(s);
-			char* new_str = reinterpret_cast<char*>(malloc(length + len + 1));
-			if(new_str){
-				//分成三块区域，插入前的区域，待插入的区域，插入后的区域
-				//要注意new_str也要随着增加，不然相当于重复在new_str上赋值三次，而不是在三个不同的区域赋值
-				strncpy(new_str, str, i);
-				strcpy(new_str + i, s);
-				strcpy(new_str + i + len, str + i);
-
-				str = new_str;
-				length = strlen(str);
-			}
-			else{
-				THROW_EXCEPTION(NotEnoughMemoryException, "No memeory to insert string value ...");
+		if((s != NULL)&&(len > 0)){
+			//s指向自身时，扩容和移动都会破坏s的内容，因此先拷贝一份
+			String temp;
+			if((s >= str) && (s <= str + length)){
+				temp._assign(s, len);
+				s = temp.str;
 			}
+			//容量不够时几何级数扩容，然后在原有空间中后移插入位置之后的内容
+			_reserve(length + len);
+			memmove(str + i + len, str + i, length - i + 1);
+			memcpy(str + i, s, len);
+			length += len;
+			m_hash = 0;
 		}
 	}
 	else{
@@ -296,20 +436,13 @@ String& String::Insert(int i, const char* s){
 	return *this;
 }
 
-String& String::Insert(int i, const String& s){
-	return Insert(i, s.str);
-}
-
 String& String::Remove(int i, unsigned int len){
 	if((i >= 0)&&( i < length)){
-		//将i+len的元素向前移动len位。k代表位移次数，最终字符串长度变成 i + k
-		unsigned int k = 0;
-		while((i + len + k) < length){
-			str[i + k] = str[i + k + len];
-			k++;
-		}
-		str[i + k] = '\0';
-		length = i + k;
+		//将i+len之后的元素（包括'\0'）整体向前移动len位，超过尾部的部分忽略
+		len = (len < length - i) ? len : length - i;
+		memmove(str + i, str + i + len, length - i - len + 1);
+		length -= len;
+		m_hash = 0;
 	}
 	return *this;
 }
@@ -317,24 +450,15 @@ String& String::Remove(int i, unsigned int len){
 
 //去掉字符串两端的空白字符
 String& String::Trim(){
-	//start，end本别代表两端第一个不为空格的位置
+	//start，end本别代表两端第一个不为空格的位置（end为最后一个非空格的下一个位置）
 	unsigned int start = 0;
-	unsigned int end = length - 1;
-
-	while(str[start] == ' ') start++;
-	while(str[end] == ' ') end--;
-	cout<<start<<endl;
-	cout<<end<<endl;
-	#define LENGTH end - start + 1
+	unsigned int end = length;
 
-	char* new_str = reinterpret_cast<char*>(malloc(LENGTH + 1));
+	while(start < end && str[start] == ' ') start++;
+	while(end > start && str[end - 1] == ' ') end--;
 
-	if(new_str){
-		strncpy(new_str, str + start, LENGTH);
-		free(str);
-		length = LENGTH;
-		str = new_str;		
-	}
+	//长串在原有的堆空间中前移，无需重新申请空间；短串移入内置缓冲区
+	_assign(str + start, end - start);
 
 	return *this;
 }
@@ -371,7 +495,7 @@ String& String::Trim(){
 		假设不成立，PMT[n]在PMT[n-1]的基础上减小
 */
 //使用之前，要保证p ！= NULL， pmt ！= NULL， pmt的长度要和len对应
-int* String::_make_pmt(const char* p, int* pmt, unsigned int len) const{   //O(m)
+int* String::_make_pmt(const char* p, int* pmt, unsigned int len){   //O(m)
 	//检测pmt是否为NULL
 	int *rst = pmt ? pmt : NULL;
 	unsigned int ll = 0;
@@ -404,14 +528,19 @@ int* String::_make_pmt(const char* p, int* pmt, unsigned int len) const{   //O(m
 }
 
 //返回值为字串所在位置,若不存在，则返回-1
-int String::_kmp(const char* p) const{					//O(m+n)
+int String::_kmp(const char* p) const{
 	//防止p是空指针
-	unsigned int pl = p? strlen(p): 0;
-	unsigned int sl = length;
+	return _kmp(str, length, p, p? strlen(p): 0);
+}
+
+//按长度在s中查找p，不依赖'\0'，String和StringView共用
+int String::_kmp(const char* str, unsigned int sl, const char* p, unsigned int pl){					//O(m+n)
 	int rst = -1;
 	//abcd一定不是abc的子串，因此要求sl >= pl
 	if(pl > 0 && sl >= pl){
-		int* pwt = new int[pl];
+		//较短的部分匹配表放在栈上，避免每次查找都申请堆空间
+		int buf[StringSearch::SIMD_MAX];
+		int* pwt = (pl <= StringSearch::SIMD_MAX) ? buf : new int[pl];
 		pwt = _make_pmt(p, pwt, pl);
 		if(pwt){
 			int j = 0;
@@ -436,25 +565,35 @@ int String::_kmp(const char* p) const{					//O(m+n)
 			THROW_EXCEPTION(NotEnoughMemoryException, "No memeory to find sub string ...");
 		}
 		
-		delete [] pwt;
+		if(pwt != buf){
+			delete [] pwt;
+		}
 	}
 	return rst;
 }
 
+int String::_find(const char* p, unsigned int pl) const{
+	return StringSearch::Find(str, length, p, pl);
+}
+
 int String::IndexOf(const char* s) const{
-	return _kmp(s);
+	//防止s是空指针
+	return _find(s, s? strlen(s) : 0);
 }
 int String::IndexOf(const String& s) const{
-	return _kmp(s.str);
+	return _find(s.str, s.length);
+}
+int String::IndexOf(const StringView& s) const{
+	return _find(s.Data(), s.Length());
 }
 
 
 String& String::Remove(const char* s){
-	return Remove(_kmp(s), s?strlen(s) : 0);
+	return Remove(IndexOf(s), s?strlen(s) : 0);
 }
 
 String& String::Remove(const String& s){
-	return Remove(_kmp(s.str), s.length);
+	return Remove(_find(s.str, s.length), s.length);
 }
 
 String String::operator -(const char* s){
@@ -463,7 +602,7 @@ String String::operator -(const char* s){
 }
 
 String String::operator -(const String& s){
-	return String(*this).Remove(s.str);
+	return String(*this).Remove(s);
 }
 /*
 对于 +=， -=这种操作，可以返回 this->func, 也可以返回 *this = *this -/+ s。因为重载的 + - 操作不会改变原对象，需要通过赋值函数将重载的 +/-操作赋值给原对象 *this
@@ -473,30 +612,154 @@ String String::operator -=(const char* s){
 }	
 
 String String::operator -=(const String& s){
-	return Remove(s.str);
+	return Remove(s);
 }
 
 
 
-String& String::Replace(const char* t, const char* s){
-	int loc = _kmp(t);
+String& String::_replace(const char* t, unsigned int tl, const char* s, unsigned int sl){
+	int loc = _find(t, tl);
 	if(loc >= 0){
-		Remove(t);
-		Insert(loc,s);
+		//已经知道位置，直接按位置删除，不需要再查找一次
+		Remove(loc, tl);
+		_insert(loc, s, sl);
 	}
 	return *this;
 }
 
+String& String::Replace(const char* t, const char* s){
+	return _replace(t, t? strlen(t) : 0, s, s? strlen(s) : 0);
+}
+
 String& String::Replace(const String& t, const char* s){
-	return Replace(t.str, s);
+	return _replace(t.str, t.length, s, s? strlen(s) : 0);
 }
 
 String& String::Replace(const char* t, const String& s){
-	return Replace(t, s.str);
+	return _replace(t, t? strlen(t) : 0, s.str, s.length);
 }
 
 String& String::Replace(const String& t, const String& s){
-	return Replace(t.str, s.str);
+	return _replace(t.str, t.length, s.str, s.length);
+}
+
+unsigned int String::_find_all(const StringView& t, DynamicArray<int>* pos) const{
+	unsigned int count = 0;
+	if(t.Length() > 0){
+		//Pattern拷贝了t，t指向自身时也不受影响
+		Pattern p(t);
+		int loc = p.Find(View(), 0);
+
+		while(loc >= 0){
+			if(pos != NULL){
+				//空间不够时翻倍
+				if(count == pos->Length()){
+					pos->resize(count ? count * 2 : 8);
+				}
+				(*pos)[count] = loc;
+			}
+			count++;
+			loc = p.Find(View(), loc + t.Length());
+		}
+	}
+	return count;
+}
+
+unsigned int String::Count(const StringView& t) const{
+	return _find_all(t, NULL);
+}
+
+SharedPointer<Array<int>> String::FindAll(const StringView& t) const{
+	DynamicArray<int>* rst = new DynamicArray<int>();
+	if(rst != NULL){
+		rst->resize(_find_all(t, rst));
+	}
+	else{
+		THROW_EXCEPTION(NotEnoughMemoryException, "No memory to create result array ...");
+	}
+	return rst;
+}
+
+String& String::ReplaceAll(const StringView& t, const StringView& s){
+	unsigned int tl = t.Length();
+	unsigned int sl = s.Length();
+	const char* sp = s.Data();
+	m_hash = 0;
+
+	//s指向自身时，移动会破坏s的内容，因此先拷贝一份
+	String temp;
+	if((sp >= str) && (sp <= str + length)){
+		temp._assign(sp, sl);
+		sp = temp.str;
+	}
+
+	if(tl == 0){
+		//空串不会出现
+	}
+	else if(sl <= tl){
+		//写入位置w不会超过读取位置r，r之后的内容还没有被修改，可以继续查找
+		Pattern p(t);
+		unsigned int w = 0;
+		unsigned int r = 0;
+		int loc = p.Find(View(), 0);
+
+		while(loc >= 0){
+			memmove(str + w, str + r, loc - r);
+			w += loc - r;
+			memcpy(str + w, sp, sl);
+			w += sl;
+			r = loc + tl;
+			loc = p.Find(View(), r);
+		}
+
+		memmove(str + w, str + r, length - r);
+		w += length - r;
+		str[w] = '\0';
+		length = w;
+	}
+	else{
+		DynamicArray<int> pos;
+		unsigned int count = _find_all(t, &pos);
+
+		if(count > 0){
+			unsigned int len = length + count * (sl - tl);
+			//按最终长度一次性申请空间，短串先在栈上生成
+			char buf[SSO_SIZE + 1];
+			char* dst = (len <= SSO_SIZE) ? buf : reinterpret_cast<char*>(malloc(len + 1));
+
+			if(dst != NULL){
+				unsigned int w = 0;
+				unsigned int r = 0;
+				for(unsigned int i = 0; i < count; i++){
+					memcpy(dst + w, str + r, pos[i] - r);
+					w += pos[i] - r;
+					memcpy(dst + w, sp, sl);
+					w += sl;
+					r = pos[i] + tl;
+				}
+				memcpy(dst + w, str + r, length - r);
+				dst[len] = '\0';
+
+				if(dst == buf){
+					_assign(buf, len);
+				}
+				else{
+					_release();
+					str = dst;
+					length = len;
+					m_capacity = len;
+				}
+			}
+			else{
+				THROW_EXCEPTION(NotEnoughMemoryException, "No memory to replace sub string ...");
+			}
+		}
+	}
+	return *this;
+}
+
+String& String::RemoveAll(const StringView& t){
+	return ReplaceAll(t, StringView());
 }
 
 
@@ -509,14 +772,8 @@ String String::Sub(int i, unsigned int len) const{
 		*/
 		len = ((i + len) < length)? len : length - i;
 
-		char* new_str = reinterpret_cast<char*>(malloc(len + 1));
-		if(new_str){
-			strncpy(new_str, str + i, len);
-			return String(new_str);
-		}
-		else{
-			THROW_EXCEPTION(NotEnoughMemoryException, "No enough memory to generate a sub string ...");
-		}
+		//子串直接按长度构造，只有长度超过SSO_SIZE时才申请一次堆空间
+		return String(str + i, len);
 	}
 	else{
 		THROW_EXCEPTION(IndexOutOfBoundsException, "Parameter i is invalid ...");
@@ -524,6 +781,35 @@ String String::Sub(int i, unsigned int len) const{
 
 }
 
+StringView String::View() const{
+	return StringView(str, length);
+}
+
+StringView String::SubView(int i, unsigned int len) const{
+	return View().Sub(i, len);
+}
+
+StringView String::TrimView() const{
+	return View().Trim();
+}
+
+unsigned long long String::Hash() const{
+	//0表示还没有计算（真正的哈希值为0时每次重新计算）
+	if(m_hash == 0){
+		//Hash是成员函数的名字，需要指明命名空间
+		m_hash = YzcLib::Hash::Bytes(str, length);
+	}
+	return m_hash;
+}
+
+StringTokenizer String::Split(const StringView& delim) const{
+	return StringTokenizer(View(), delim, StringTokenizer::SPLIT);
+}
+
+StringTokenizer String::Tokenize(const StringView& charset) const{
+	return StringTokenizer(View(), charset, StringTokenizer::TOKENIZE);
+}
+
 }
 
 /*
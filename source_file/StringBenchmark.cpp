@@ -0,0 +1,316 @@
+#include "./../head_file/Data_structure.h"
+#include "./../head_file/StringSearch.h"
+#include "./../head_file/Pattern.h"
+#include <cstdlib>
+#include <cstring>
+#include <cstdio>
+#include <chrono>
+
+/*
+子串查找性能测试程序
+
+编译：
+	g++ -O2 -std=c++11 source_file/StringBenchmark.cpp source_file/Object.cpp source_file/Exception.cpp source_file/String.cpp source_file/StringBuilder.cpp source_file/StringView.cpp source_file/StringSearch.cpp source_file/Pattern.cpp source_file/StringTokenizer.cpp source_file/Hash.cpp -o string_bench
+
+用法：
+	string_bench [--size MB] [--repeat R] [--algo NAME] [--text NAME] [--line N]
+	string_bench --check [--size MB]
+
+	--size		文本大小，单位MB（默认16，最大1024）
+	--repeat	每组重复计时的次数，取最小值（默认5）
+	--algo		只测试指定的算法
+	--text		只测试指定的文本
+	--line		将文本分成长度为N的行，在每一行中分别查找（默认0，不分行）
+				模拟同一个子串在大量短字符串中查找的情况，Pattern_*只在开始时编译一次，其他算法每次查找都要重新分析子串
+	--check		回归检查：全部为'a'的文本中查找 a^20000 b a^20000（周期的长子串），
+				String::Count、FindAll、ReplaceAll的结果和时间与循环调用StringSearch::Find比较，
+				结果不同或者慢10倍以上（最坏情况退化为O(n * m)）时返回1
+
+输出（CSV，第一行为表头）：
+	algorithm,text,needle_length,mb_per_second,position
+
+	子串放在文本的最后，保证每次查找都要扫描整个文本
+	position为查找结果，所有算法的结果应该相同（分行时为最后一次匹配的位置）
+
+文本：
+	random		随机小写字母（a~y），首尾字节的候选位置约为1/625
+	english		只包含少量字母和空格，字母分布不均匀
+	periodic	全部为'a'，子串为 aa..b..aa，每个位置都是SIMD过滤的候选位置，是过滤的最坏情况
+*/
+
+using namespace YzcLib;
+
+namespace{
+
+enum Algorithm{
+	KMP,
+	SCALAR,
+	SSE2,
+	AVX2,
+	TWOWAY,
+	FIND,
+	PATTERN_KMP,
+	PATTERN_HORSPOOL,
+	PATTERN,
+	ALGORITHM_COUNT
+};
+
+const char* ALGORITHM_NAME[ALGORITHM_COUNT] = {
+	"KMP",
+	"Scalar",
+	"SSE2",
+	"AVX2",
+	"TwoWay",
+	"Find",
+	"Pattern_KMP",
+	"Pattern_Horspool",
+	"Pattern"
+};
+
+enum Text{
+	RANDOM,
+	ENGLISH,
+	PERIODIC,
+	TEXT_COUNT
+};
+
+const char* TEXT_NAME[TEXT_COUNT] = {
+	"random",
+	"english",
+	"periodic"
+};
+
+const unsigned int NEEDLE_LENGTH[] = {1, 2, 4, 8, 16, 32, 64, 256};
+const unsigned int NEEDLE_COUNT = sizeof(NEEDLE_LENGTH) / sizeof(NEEDLE_LENGTH[0]);
+
+unsigned long long g_seed = 88172645463325252ULL;
+
+unsigned long long Random(){
+	g_seed ^= g_seed << 13;
+	g_seed ^= g_seed >> 7;
+	g_seed ^= g_seed << 17;
+	return g_seed;
+}
+
+char RandomChar(Text t){
+	static const char ENGLISH_CHAR[] = "etaoin  ";
+	char rst = 'a';
+	switch(t){
+	case RANDOM:	rst = 'a' + Random() % 25; break;
+	case ENGLISH:	rst = ENGLISH_CHAR[Random() % 8]; break;
+	default:		rst = 'a'; break;
+	}
+	return rst;
+}
+
+/*
+生成文本和子串，子串只在文本的末尾出现一次
+*/
+void Generate(char* s, unsigned int sl, char* p, unsigned int pl, Text t){
+	if((pl == 0) || (pl > sl)){
+		return;
+	}
+	for(unsigned int i = 0; i < pl; i++){
+		p[i] = RandomChar(t);
+	}
+	//'z'和'b'不会出现在文本中，保证只在末尾匹配
+	//periodic的子串为 aa..b..aa，首尾字节与文本中每个位置都相同
+	if(t == PERIODIC){
+		p[pl / 2] = 'b';
+	}
+	else{
+		p[pl - 1] = 'z';
+	}
+
+	for(unsigned int i = 0; i < sl - pl; i++){
+		s[i] = RandomChar(t);
+	}
+	memcpy(s + sl - pl, p, pl);
+}
+
+int Run(Algorithm algo, const char* s, unsigned int sl, const char* p, unsigned int pl, const Pattern* pattern){
+	int rst = -1;
+	switch(algo){
+	case KMP:		rst = StringSearch::KMP(s, sl, p, pl); break;
+	case SCALAR:	rst = StringSearch::Scalar(s, sl, p, pl); break;
+	case SSE2:		rst = StringSearch::SSE2(s, sl, p, pl); break;
+	case AVX2:		rst = StringSearch::AVX2(s, sl, p, pl); break;
+	case TWOWAY:	rst = StringSearch::TwoWay(s, sl, p, pl); break;
+	case FIND:		rst = StringSearch::Find(s, sl, p, pl); break;
+	default:		rst = pattern->Find(s, sl); break;
+	}
+	return rst;
+}
+
+/*
+line为0时在整个文本中查找，否则在每一行中分别查找，行之间相互独立（子串可以跨越两行时在下一行中找不到）
+Pattern_*的编译在计时之内，只进行一次
+*/
+int Search(Algorithm algo, const char* s, unsigned int sl, const char* p, unsigned int pl, unsigned int line){
+	Pattern::Strategy strategy = Pattern::AUTO;
+	strategy = (algo == PATTERN_KMP) ? Pattern::KMP : strategy;
+	strategy = (algo == PATTERN_HORSPOOL) ? Pattern::HORSPOOL : strategy;
+	Pattern pattern(p, pl, strategy);
+
+	int rst = -1;
+	if(line == 0){
+		rst = Run(algo, s, sl, p, pl, &pattern);
+	}
+	else{
+		for(unsigned int i = 0; i < sl; i += line){
+			unsigned int len = (sl - i < line) ? sl - i : line;
+			int pos = Run(algo, s + i, len, p, pl, &pattern);
+			rst = (pos >= 0) ? static_cast<int>(i) + pos : rst;
+		}
+	}
+	return rst;
+}
+
+/*
+周期的长子串：Horspool在这种文本上每次右移1位，每次验证比较约20000个字节
+子串在文本中出现3次，单次查找（StringSearch::Find）为线性时间，作为参照
+*/
+int Check(unsigned int sl){
+	const unsigned int half = 20000;
+	const unsigned int pl = 2 * half + 1;
+	String p;
+	String text;
+	{
+		char* buf = reinterpret_cast<char*>(malloc(sl + 1));
+		if(buf == NULL){
+			fprintf(stderr, "no memory for check\n");
+			return 1;
+		}
+		memset(buf, 'a', sl);
+		buf[half] = 'b';
+		p = String(buf, pl);
+		for(unsigned int k = 1; k <= 3; k++){
+			buf[sl / 4 * k + half] = 'b';
+		}
+		buf[half] = 'a';
+		text = String(buf, sl);
+		free(buf);
+	}
+
+	std::chrono::steady_clock::time_point begin = std::chrono::steady_clock::now();
+	unsigned int expected = 0;
+	int last = -1;
+	for(unsigned int pos = 0; pos + pl <= sl; ){
+		int r = StringSearch::Find(text.Str() + pos, sl - pos, p.Str(), pl);
+		if(r < 0) break;
+		expected++;
+		last = pos + r;
+		pos += r + pl;
+	}
+	double loop = std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count();
+
+	begin = std::chrono::steady_clock::now();
+	unsigned int count = text.Count(p.View());
+	SharedPointer<Array<int>> all = text.FindAll(p.View());
+	String replaced = text;
+	replaced.ReplaceAll(p.View(), StringView("x", 1));
+	double single = std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count();
+
+	bool ok = (count == expected) && (all->Length() == expected) && (expected == 3) && \
+			  ((*all)[expected - 1] == last) && (replaced.Length() == sl - expected * (pl - 1));
+	//三个单遍的接口各扫描一遍，加上拷贝，允许10倍的差距
+	bool fast = single <= 10 * loop + 0.05;
+
+	printf("check,count=%u,expected=%u,loop_ms=%.1f,single_pass_ms=%.1f,%s\n", count, expected, loop * 1000, single * 1000, (ok && fast) ? "ok" : "FAIL");
+	return (ok && fast) ? 0 : 1;
+}
+
+int Find(const char* name, const char* const table[], int len){
+	int rst = -1;
+	for(int i = 0; i < len; i++){
+		if(strcmp(name, table[i]) == 0){
+			rst = i;
+			break;
+		}
+	}
+	return rst;
+}
+
+}
+
+int main(int argc, char* argv[]){
+	unsigned long size = 16;
+	unsigned int repeat = 5;
+	int onlyAlgo = -1;
+	int onlyText = -1;
+	unsigned int line = 0;
+	bool check = false;
+
+	for(int i = 1; i < argc; i++){
+		if(strcmp(argv[i], "--size") == 0 && i + 1 < argc){
+			size = strtoul(argv[++i], NULL, 10);
+		}
+		else if(strcmp(argv[i], "--repeat") == 0 && i + 1 < argc){
+			repeat = strtoul(argv[++i], NULL, 10);
+		}
+		else if(strcmp(argv[i], "--algo") == 0 && i + 1 < argc){
+			onlyAlgo = Find(argv[++i], ALGORITHM_NAME, ALGORITHM_COUNT);
+		}
+		else if(strcmp(argv[i], "--text") == 0 && i + 1 < argc){
+			onlyText = Find(argv[++i], TEXT_NAME, TEXT_COUNT);
+		}
+		else if(strcmp(argv[i], "--line") == 0 && i + 1 < argc){
+			line = strtoul(argv[++i], NULL, 10);
+		}
+		else if(strcmp(argv[i], "--check") == 0){
+			check = true;
+		}
+		else{
+			fprintf(stderr, "unknown option: %s\n", argv[i]);
+			return 1;
+		}
+	}
+
+	size = (size == 0) ? 1 : ((size > 1024) ? 1024 : size);
+	repeat = (repeat == 0) ? 1 : repeat;
+
+	unsigned int sl = size << 20;
+	if(check){
+		return Check(sl);
+	}
+
+	char* s = reinterpret_cast<char*>(malloc(sl));
+	char p[256];
+	if(s == NULL){
+		fprintf(stderr, "no memory for %lu MB text\n", size);
+		return 1;
+	}
+
+	fprintf(stderr, "SSE2: %d, AVX2: %d\n", StringSearch::HasSSE2() ? 1 : 0, StringSearch::HasAVX2() ? 1 : 0);
+	printf("algorithm,text,needle_length,mb_per_second,position\n");
+
+	for(int t = 0; t < TEXT_COUNT; t++){
+		if(onlyText >= 0 && onlyText != t) continue;
+
+		for(unsigned int n = 0; n < NEEDLE_COUNT; n++){
+			unsigned int pl = NEEDLE_LENGTH[n];
+			Generate(s, sl, p, pl, static_cast<Text>(t));
+
+			for(int a = 0; a < ALGORITHM_COUNT; a++){
+				if(onlyAlgo >= 0 && onlyAlgo != a) continue;
+
+				double best = -1;
+				int pos = -1;
+				for(unsigned int r = 0; r < repeat; r++){
+					std::chrono::steady_clock::time_point begin = std::chrono::steady_clock::now();
+					pos = Search(static_cast<Algorithm>(a), s, sl, p, pl, line);
+					std::chrono::steady_clock::time_point end = std::chrono::steady_clock::now();
+
+					double sec = std::chrono::duration<double>(end - begin).count();
+					if(best < 0 || sec < best) best = sec;
+				}
+
+				printf("%s,%s,%u,%.1f,%d\n", ALGORITHM_NAME[a], TEXT_NAME[t], pl, (best > 0) ? size / best : 0.0, pos);
+				fflush(stdout);
+			}
+		}
+	}
+
+	free(s);
+	return 0;
+}
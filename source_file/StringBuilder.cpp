@@ -0,0 +1,80 @@
+#include "./../head_file/StringBuilder.h"
+//malloc,free
+#include <cstdlib>
+#include <cstring>
+#include <cstdio>
+#include "./../head_file/Exception.h"
+
+namespace YzcLib{
+
+StringBuilder::StringBuilder(unsigned int capacity){
+	m_capacity = (capacity > 0) ? capacity : 1;
+	m_length = 0;
+	m_buf = reinterpret_cast<char*>(malloc(m_capacity));
+
+	if(m_buf == NULL){
+		THROW_EXCEPTION(NotEnoughMemoryException, "No memory to create StringBuilder object ...");
+	}
+}
+
+void StringBuilder::_reserve(unsigned int capacity){
+	if(capacity > m_capacity){
+		unsigned int new_capacity = (m_capacity * 2 > capacity) ? m_capacity * 2 : capacity;
+		char* new_buf = reinterpret_cast<char*>(malloc(new_capacity));
+
+		if(new_buf){
+			memcpy(new_buf, m_buf, m_length);
+			free(m_buf);
+			m_buf = new_buf;
+			m_capacity = new_capacity;
+		}
+		else{
+			THROW_EXCEPTION(NotEnoughMemoryException, "No memory to enlarge StringBuilder object ...");
+		}
+	}
+}
+
+StringBuilder& StringBuilder::Append(const char* s){
+	return s ? Append(s, strlen(s)) : *this;
+}
+
+StringBuilder& StringBuilder::Append(const char* s, unsigned int len){
+	if((s != NULL) && (len > 0)){
+		_reserve(m_length + len);
+		memcpy(m_buf + m_length, s, len);
+		m_length += len;
+	}
+	return *this;
+}
+
+StringBuilder& StringBuilder::Append(const String& s){
+	return Append(s.Str(), s.Length());
+}
+
+StringBuilder& StringBuilder::Append(char c){
+	return Append(&c, 1);
+}
+
+StringBuilder& StringBuilder::Append(int i){
+	char s[16] = {0};
+	int len = sprintf(s, "%d", i);
+	return Append(s, len);
+}
+
+unsigned int StringBuilder::Length() const{
+	return m_length;
+}
+
+void StringBuilder::Clear(){
+	m_length = 0;
+}
+
+String StringBuilder::ToString() const{
+	return String(m_buf, m_length);
+}
+
+StringBuilder::~StringBuilder(){
+	free(m_buf);
+}
+
+}
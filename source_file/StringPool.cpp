@@ -0,0 +1,152 @@
+#include "./../head_file/StringPool.h"
+#include "./../head_file/Hash.h"
+//malloc,free
+#include <cstdlib>
+#include <cstring>
+#include "./../head_file/Exception.h"
+
+namespace YzcLib{
+
+StringPool::StringPool(){
+	m_block_count = 0;
+	m_block = NULL;
+	m_used = 0;
+	m_size = 0;
+	m_count = 0;
+	m_mask = 0;
+
+	_rehash(16);
+}
+
+const char* StringPool::_store(const char* s, unsigned int len){
+	if((m_block == NULL) || (m_used + len + 1 > m_size)){
+		//块的大小至少翻倍，超长的字符串单独一个块
+		unsigned int size = (m_size > 0) ? m_size * 2 : 4096;
+		size = (size < len + 1) ? len + 1 : size;
+
+		char* block = reinterpret_cast<char*>(malloc(size));
+		if(block == NULL){
+			THROW_EXCEPTION(NotEnoughMemoryException, "No memory to store string in StringPool ...");
+		}
+
+		if(m_block_count == m_blocks.Length()){
+			m_blocks.resize(m_block_count ? m_block_count * 2 : 8);
+		}
+		m_blocks[m_block_count++] = block;
+
+		m_block = block;
+		m_used = 0;
+		m_size = size;
+	}
+
+	char* rst = m_block + m_used;
+	memcpy(rst, s, len);
+	rst[len] = '\0';
+	m_used += len + 1;
+	return rst;
+}
+
+unsigned int StringPool::_slot(const char* s, unsigned int len, unsigned long long hash) const{
+	const unsigned int* table = m_table.GetArray();
+	unsigned int i = static_cast<unsigned int>(hash) & m_mask;
+
+	//装载因子不超过1/2，一定能找到空位
+	while(table[i] != 0){
+		unsigned int h = table[i] - 1;
+		if((m_hash.GetArray()[h] == hash) && (m_len.GetArray()[h] == len) && (memcmp(m_str.GetArray()[h], s, len) == 0)){
+			break;
+		}
+		i = (i + 1) & m_mask;
+	}
+	return i;
+}
+
+void StringPool::_rehash(unsigned int capacity){
+	m_table.resize(capacity);
+	m_mask = capacity - 1;
+
+	unsigned int* table = m_table.GetArray();
+	for(unsigned int i = 0; i < capacity; i++){
+		table[i] = 0;
+	}
+
+	//已有的内容各不相同，只需要找空位
+	for(unsigned int h = 0; h < m_count; h++){
+		unsigned int i = static_cast<unsigned int>(m_hash[h]) & m_mask;
+		while(table[i] != 0){
+			i = (i + 1) & m_mask;
+		}
+		table[i] = h + 1;
+	}
+}
+
+StringPool::Handle StringPool::Intern(const StringView& s){
+	unsigned long long hash = Hash::Bytes(s.Data(), s.Length());
+	unsigned int i = _slot(s.Data(), s.Length(), hash);
+	Handle rst = 0;
+
+	if(m_table[i] != 0){
+		rst = m_table[i] - 1;
+	}
+	else{
+		//先拷贝内容，s可能指向池中的内容（不会被移动），也可能是临时对象
+		const char* str = _store(s.Data(), s.Length());
+
+		if(m_count == m_str.Length()){
+			unsigned int n = m_count ? m_count * 2 : 16;
+			m_str.resize(n);
+			m_len.resize(n);
+			m_hash.resize(n);
+		}
+		rst = m_count++;
+		m_str[rst] = str;
+		m_len[rst] = s.Length();
+		m_hash[rst] = hash;
+		m_table[i] = rst + 1;
+
+		//装载因子超过1/2时容量翻倍
+		if(m_count * 2 > m_mask + 1){
+			_rehash((m_mask + 1) * 2);
+		}
+	}
+	return rst;
+}
+
+bool StringPool::Find(const StringView& s, Handle& h) const{
+	unsigned int i = _slot(s.Data(), s.Length(), Hash::Bytes(s.Data(), s.Length()));
+	bool rst = (m_table.GetArray()[i] != 0);
+	if(rst){
+		h = m_table.GetArray()[i] - 1;
+	}
+	return rst;
+}
+
+StringView StringPool::Get(Handle h) const{
+	if(h < m_count){
+		return StringView(m_str.GetArray()[h], m_len.GetArray()[h]);
+	}
+	else{
+		THROW_EXCEPTION(IndexOutOfBoundsException, "Handle is invalid ...");
+	}
+}
+
+const char* StringPool::Str(Handle h) const{
+	if(h < m_count){
+		return m_str.GetArray()[h];
+	}
+	else{
+		THROW_EXCEPTION(IndexOutOfBoundsException, "Handle is invalid ...");
+	}
+}
+
+unsigned int StringPool::Count() const{
+	return m_count;
+}
+
+StringPool::~StringPool(){
+	for(unsigned int i = 0; i < m_block_count; i++){
+		free(m_blocks[i]);
+	}
+}
+
+}
@@ -0,0 +1,326 @@
+#include "./../head_file/StringSearch.h"
+#include "./../head_file/String.h"
+#include <cstring>
+
+//只在x86上使用SIMD，其他平台退化为Scalar/KMP
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define STRINGSEARCH_X86
+#include <immintrin.h>
+#endif
+
+namespace YzcLib{
+
+/*
+首尾字节过滤的公共部分：
+	mask中第k位为1，说明s[i + k]处首尾字节都相同，验证中间的pl - 2个字节
+	每处理一个候选位置，清除mask的最低位
+
+	过滤在一般的文本上很快，但是对于特殊的文本（例如 aaaa... 中查找 aa..b..aa），每个位置都是候选位置，复杂度退化为O(n * m)
+	bounded为true时统计验证失败的次数，平均每32个字节失败超过一次时放弃过滤，stop记录放弃的位置（之前的位置都已经确认不匹配）
+*/
+#define STRINGSEARCH_VERIFY(mask, i)											\
+	while(mask){																\
+		unsigned int k = __builtin_ctz(mask);									\
+		if(memcmp(s + i + k + 1, p + 1, pl - 2) == 0){							\
+			return i + k;														\
+		}																		\
+		if(bounded && (++fails > 64 + (i >> 5))){								\
+			stop = i;															\
+			return -1;															\
+		}																		\
+		mask &= mask - 1;														\
+	}
+
+#ifdef STRINGSEARCH_X86
+
+//SSE2是x86_64的基本指令集，无需检测；32位x86需要检测
+static int _find_sse2(const char* s, unsigned int sl, const char* p, unsigned int pl, bool bounded, unsigned int& stop) __attribute__((target("sse2")));
+static int _find_sse2(const char* s, unsigned int sl, const char* p, unsigned int pl, bool bounded, unsigned int& stop){
+	const __m128i first = _mm_set1_epi8(p[0]);
+	const __m128i last = _mm_set1_epi8(p[pl - 1]);
+	unsigned int fails = 0;
+	unsigned int i = 0;
+
+	//两次读入都不能越过s的尾部
+	for(; i + pl - 1 + 16 <= sl; i += 16){
+		__m128i bf = _mm_loadu_si128(reinterpret_cast<const __m128i*>(s + i));
+		__m128i bl = _mm_loadu_si128(reinterpret_cast<const __m128i*>(s + i + pl - 1));
+		unsigned int mask = _mm_movemask_epi8(_mm_and_si128(_mm_cmpeq_epi8(first, bf), _mm_cmpeq_epi8(last, bl)));
+
+		STRINGSEARCH_VERIFY(mask, i)
+	}
+
+	//剩余不足一个向量的部分，起点少于16个
+	int rst = StringSearch::Scalar(s + i, sl - i, p, pl);
+	return (rst >= 0) ? static_cast<int>(i) + rst : -1;
+}
+
+static int _find_avx2(const char* s, unsigned int sl, const char* p, unsigned int pl, bool bounded, unsigned int& stop) __attribute__((target("avx2")));
+static int _find_avx2(const char* s, unsigned int sl, const char* p, unsigned int pl, bool bounded, unsigned int& stop){
+	const __m256i first = _mm256_set1_epi8(p[0]);
+	const __m256i last = _mm256_set1_epi8(p[pl - 1]);
+	unsigned int fails = 0;
+	unsigned int i = 0;
+
+	for(; i + pl - 1 + 32 <= sl; i += 32){
+		__m256i bf = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(s + i));
+		__m256i bl = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(s + i + pl - 1));
+		unsigned int mask = _mm256_movemask_epi8(_mm256_and_si256(_mm256_cmpeq_epi8(first, bf), _mm256_cmpeq_epi8(last, bl)));
+
+		STRINGSEARCH_VERIFY(mask, i)
+	}
+
+	//剩余部分交给SSE2处理
+	unsigned int tail = sl - i;
+	int rst = _find_sse2(s + i, sl - i, p, pl, bounded, tail);
+	if(tail < sl - i){
+		stop = i + tail;
+	}
+	return (rst >= 0) ? static_cast<int>(i) + rst : -1;
+}
+
+#endif
+
+#undef STRINGSEARCH_VERIFY
+
+bool StringSearch::HasSSE2(){
+#ifdef STRINGSEARCH_X86
+	return __builtin_cpu_supports("sse2");
+#else
+	return false;
+#endif
+}
+
+bool StringSearch::HasAVX2(){
+#ifdef STRINGSEARCH_X86
+	return __builtin_cpu_supports("avx2");
+#else
+	return false;
+#endif
+}
+
+StringSearch::Filter StringSearch::_select(){
+	Filter rst = NULL;
+#ifdef STRINGSEARCH_X86
+	if(HasAVX2()){
+		rst = _find_avx2;
+	}
+	else if(HasSSE2()){
+		rst = _find_sse2;
+	}
+#endif
+	return rst;
+}
+
+int StringSearch::Find(const char* s, unsigned int sl, const char* p, unsigned int pl){
+	return _find(s, sl, p, pl, NULL);
+}
+
+int StringSearch::Find(const char* s, unsigned int sl, const char* p, unsigned int pl, const Factor& f){
+	return _find(s, sl, p, pl, &f);
+}
+
+int StringSearch::_find(const char* s, unsigned int sl, const char* p, unsigned int pl, const Factor* f){
+	//CPU检测只在第一次调用时进行
+	static const Filter filter = _select();
+	int rst = -1;
+
+	if((s != NULL) && (p != NULL) && (pl > 0) && (sl >= pl)){
+		if(pl == 1){
+			const char* pos = reinterpret_cast<const char*>(memchr(s, p[0], sl));
+			rst = pos ? static_cast<int>(pos - s) : -1;
+		}
+		else if(filter != NULL){
+			//限制过滤的验证次数，过滤失效时从放弃的位置开始使用Two-Way，保证线性时间
+			unsigned int stop = sl;
+			rst = filter(s, sl, p, pl, true, stop);
+			if((rst < 0) && (stop < sl)){
+				rst = f ? TwoWay(s + stop, sl - stop, p, pl, *f) : TwoWay(s + stop, sl - stop, p, pl);
+				rst = (rst >= 0) ? static_cast<int>(stop) + rst : -1;
+			}
+		}
+		else if(pl > SIMD_MAX){
+			rst = f ? TwoWay(s, sl, p, pl, *f) : TwoWay(s, sl, p, pl);
+		}
+		else{
+			rst = KMP(s, sl, p, pl);
+		}
+	}
+	return rst;
+}
+
+int StringSearch::KMP(const char* s, unsigned int sl, const char* p, unsigned int pl){
+	return String::_kmp(s, sl, p, pl);
+}
+
+int StringSearch::Scalar(const char* s, unsigned int sl, const char* p, unsigned int pl){
+	int rst = -1;
+	if((pl > 0) && (sl >= pl)){
+		const char* end = s + sl - pl + 1;	//最后一个可能的起点之后
+		const char* pos = s;
+
+		while((pos = reinterpret_cast<const char*>(memchr(pos, p[0], end - pos))) != NULL){
+			if(memcmp(pos + 1, p + 1, pl - 1) == 0){
+				rst = static_cast<int>(pos - s);
+				break;
+			}
+			pos++;
+		}
+	}
+	return rst;
+}
+
+int StringSearch::SSE2(const char* s, unsigned int sl, const char* p, unsigned int pl){
+	int rst = -1;
+	if((pl > 0) && (sl >= pl)){
+#ifdef STRINGSEARCH_X86
+		unsigned int stop = sl;
+		rst = (pl > 1 && HasSSE2()) ? _find_sse2(s, sl, p, pl, false, stop) : Scalar(s, sl, p, pl);
+#else
+		rst = Scalar(s, sl, p, pl);
+#endif
+	}
+	return rst;
+}
+
+int StringSearch::AVX2(const char* s, unsigned int sl, const char* p, unsigned int pl){
+	int rst = -1;
+	if((pl > 0) && (sl >= pl)){
+#ifdef STRINGSEARCH_X86
+		unsigned int stop = sl;
+		rst = (pl > 1 && HasAVX2()) ? _find_avx2(s, sl, p, pl, false, stop) : Scalar(s, sl, p, pl);
+#else
+		rst = Scalar(s, sl, p, pl);
+#endif
+	}
+	return rst;
+}
+
+/*
+最大后缀的计算（Crochemore-Perrin）
+	ms为当前最大后缀起点的前一个位置，j + k为正在比较的位置，period为当前后缀的周期
+	a < b（反序时a > b）：以ms + 1开始的后缀更大，跳过已经比较的部分，周期变为j - ms
+	a == b：继续比较，满一个周期后j前进一个周期
+	a > b（反序时a < b）：以j开始的后缀更大，从j重新开始
+*/
+int StringSearch::_max_suffix(const unsigned char* p, unsigned int pl, unsigned int& period, bool reverse){
+	int ms = -1;
+	unsigned int j = 0;
+	unsigned int k = 1;
+	period = 1;
+
+	while(j + k < pl){
+		unsigned char a = p[j + k];
+		unsigned char b = p[ms + k];
+		if(reverse ? (a > b) : (a < b)){
+			j += k;
+			k = 1;
+			period = j - ms;
+		}
+		else if(a == b){
+			if(k != period){
+				k++;
+			}
+			else{
+				j += period;
+				k = 1;
+			}
+		}
+		else{
+			ms = j;
+			j = ms + 1;
+			k = period = 1;
+		}
+	}
+	return ms;
+}
+
+void StringSearch::Factorize(const char* p, unsigned int pl, Factor& f){
+	const unsigned char* x = reinterpret_cast<const unsigned char*>(p);
+	const int m = pl;
+
+	//ell为分解点u的最后一个位置，per为v的周期
+	unsigned int p1 = 1;
+	unsigned int p2 = 1;
+	int i1 = _max_suffix(x, pl, p1, false);
+	int i2 = _max_suffix(x, pl, p2, true);
+	f.ell = (i1 > i2) ? i1 : i2;
+	f.per = (i1 > i2) ? p1 : p2;
+	f.periodic = (memcmp(x, x + f.per, f.ell + 1) == 0);
+
+	if(!f.periodic){
+		//p不是周期的，u失配时可以移动max(|u|, |v|) + 1
+		f.per = ((f.ell + 1 > m - f.ell - 1) ? f.ell + 1 : m - f.ell - 1) + 1;
+	}
+}
+
+int StringSearch::TwoWay(const char* s, unsigned int sl, const char* p, unsigned int pl){
+	int rst = -1;
+	if((pl > 0) && (sl >= pl)){
+		Factor f;
+		Factorize(p, pl, f);
+		rst = TwoWay(s, sl, p, pl, f);
+	}
+	return rst;
+}
+
+int StringSearch::TwoWay(const char* s, unsigned int sl, const char* p, unsigned int pl, const Factor& f){
+	int rst = -1;
+	if((pl > 0) && (sl >= pl)){
+		const unsigned char* x = reinterpret_cast<const unsigned char*>(p);
+		const unsigned char* y = reinterpret_cast<const unsigned char*>(s);
+		const int m = pl;
+		const int n = sl;
+		const int ell = f.ell;
+		const int per = f.per;
+
+		if(f.periodic){
+			//p是周期的，memory记录上一次已经确认匹配的前缀的最后一个位置
+			int j = 0;
+			int memory = -1;
+			while(j <= n - m){
+				int i = ((ell > memory) ? ell : memory) + 1;
+				while(i < m && x[i] == y[i + j]) i++;
+
+				if(i >= m){
+					i = ell;
+					while(i > memory && x[i] == y[i + j]) i--;
+					if(i <= memory){
+						rst = j;
+						break;
+					}
+					j += per;
+					memory = m - per - 1;
+				}
+				else{
+					j += i - ell;
+					memory = -1;
+				}
+			}
+		}
+		else{
+			//p不是周期的，u失配时移动max(|u|, |v|) + 1（Factorize中已经计算）
+			int j = 0;
+			while(j <= n - m){
+				int i = ell + 1;
+				while(i < m && x[i] == y[i + j]) i++;
+
+				if(i >= m){
+					i = ell;
+					while(i >= 0 && x[i] == y[i + j]) i--;
+					if(i < 0){
+						rst = j;
+						break;
+					}
+					j += per;
+				}
+				else{
+					j += i - ell;
+				}
+			}
+		}
+	}
+	return rst;
+}
+
+}
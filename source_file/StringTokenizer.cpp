@@ -0,0 +1,170 @@
+#include "./../head_file/StringTokenizer.h"
+#include "./../head_file/StringSearch.h"
+#include <cstring>
+#include "./../head_file/Exception.h"
+
+//与StringSearch相同，只在x86上使用SIMD
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define STRINGTOKENIZER_X86
+#include <emmintrin.h>
+#endif
+
+namespace YzcLib{
+
+#ifdef STRINGTOKENIZER_X86
+
+/*
+在s[0, len)中查找set中任意一个字符第一次出现的位置，没有返回len
+每次读入16个字节，与每个字符比较一次，结果按位或
+*/
+static unsigned int _find_any_sse2(const char* s, unsigned int len, const char* set, unsigned int n) __attribute__((target("sse2")));
+static unsigned int _find_any_sse2(const char* s, unsigned int len, const char* set, unsigned int n){
+	__m128i c[StringTokenizer::SIMD_CHARS];
+	for(unsigned int k = 0; k < n; k++){
+		c[k] = _mm_set1_epi8(set[k]);
+	}
+
+	unsigned int i = 0;
+	for(; i + 16 <= len; i += 16){
+		__m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i*>(s + i));
+		__m128i eq = _mm_cmpeq_epi8(b, c[0]);
+		for(unsigned int k = 1; k < n; k++){
+			eq = _mm_or_si128(eq, _mm_cmpeq_epi8(b, c[k]));
+		}
+
+		unsigned int mask = _mm_movemask_epi8(eq);
+		if(mask){
+			return i + __builtin_ctz(mask);
+		}
+	}
+
+	//剩余不足16个字节
+	for(; i < len; i++){
+		for(unsigned int k = 0; k < n; k++){
+			if(s[i] == set[k]){
+				return i;
+			}
+		}
+	}
+	return len;
+}
+
+#endif
+
+StringTokenizer::StringTokenizer(const StringView& text, const StringView& delim, Mode mode){
+	if(delim.Length() == 0){
+		THROW_EXCEPTION(InvalidParameterException, "Delimiter of StringTokenizer can not be empty ...");
+	}
+
+	m_text = text;
+	m_mode = mode;
+	memset(m_set, 0, sizeof(m_set));
+
+	if(mode == TOKENIZE){
+		//字符集去重，方便SSE2减少比较的次数
+		String chars;
+		for(unsigned int i = 0; i < delim.Length(); i++){
+			unsigned char c = delim[i];
+			if(!_is_delim(c)){
+				m_set[c >> 5] |= 1u << (c & 31);
+				chars += String(static_cast<char>(c));
+			}
+		}
+		m_delim = chars;
+	}
+	else{
+		m_delim = delim.ToString();
+	}
+
+	Move();
+}
+
+bool StringTokenizer::_is_delim(unsigned char c) const{
+	return (m_set[c >> 5] >> (c & 31)) & 1;
+}
+
+unsigned int StringTokenizer::_find_any(unsigned int i) const{
+	const char* s = m_text.Data();
+	unsigned int len = m_text.Length();
+	unsigned int n = m_delim.Length();
+	unsigned int rst = len;
+
+	if(n == 1){
+		const char* pos = reinterpret_cast<const char*>(memchr(s + i, m_delim[0], len - i));
+		rst = pos ? static_cast<unsigned int>(pos - s) : len;
+	}
+#ifdef STRINGTOKENIZER_X86
+	else if((n <= SIMD_CHARS) && StringSearch::HasSSE2()){
+		rst = i + _find_any_sse2(s + i, len - i, m_delim.Str(), n);
+	}
+#endif
+	else{
+		while((i < len) && !_is_delim(s[i])) i++;
+		rst = i;
+	}
+	return rst;
+}
+
+unsigned int StringTokenizer::_skip_any(unsigned int i) const{
+	//连续的分隔符一般很短，逐个字节查表即可
+	const char* s = m_text.Data();
+	unsigned int len = m_text.Length();
+	while((i < len) && _is_delim(s[i])) i++;
+	return i;
+}
+
+void StringTokenizer::_advance(){
+	unsigned int len = m_text.Length();
+	const char* s = m_text.Data();
+
+	if(m_pos > len){
+		m_end = true;
+	}
+	else if(m_mode == SPLIT){
+		int d = StringSearch::Find(s + m_pos, len - m_pos, m_delim.Str(), m_delim.Length());
+		unsigned int end = (d >= 0) ? m_pos + d : len;
+
+		m_current = StringView(s + m_pos, end - m_pos);
+		//最后一个词之后m_pos越过文本的尾部，下一次结束
+		m_pos = (d >= 0) ? end + m_delim.Length() : len + 1;
+	}
+	else{
+		unsigned int start = _skip_any(m_pos);
+		if(start < len){
+			unsigned int end = _find_any(start);
+			m_current = StringView(s + start, end - start);
+			m_pos = end;
+		}
+		else{
+			m_pos = len + 1;
+			m_end = true;
+		}
+	}
+}
+
+bool StringTokenizer::Move(){
+	m_pos = 0;
+	m_end = false;
+	_advance();
+	return !m_end;
+}
+
+bool StringTokenizer::Next(){
+	if(!m_end){
+		_advance();
+	}
+	return !m_end;
+}
+
+StringView StringTokenizer::Current() const{
+	if(m_end){
+		THROW_EXCEPTION(InvalidOperationException, "No token at current position ...");
+	}
+	return m_current;
+}
+
+bool StringTokenizer::End() const{
+	return m_end;
+}
+
+}
@@ -0,0 +1,142 @@
+#include "./../head_file/StringView.h"
+#include "./../head_file/String.h"
+#include "./../head_file/StringSearch.h"
+#include "./../head_file/StringTokenizer.h"
+#include "./../head_file/Hash.h"
+#include <cstring>
+#include "./../head_file/Exception.h"
+
+namespace YzcLib{
+
+StringView::StringView(){
+	m_str = "";
+	m_length = 0;
+}
+
+StringView::StringView(const char* s){
+	m_str = s ? s : "";
+	m_length = strlen(m_str);
+}
+
+StringView::StringView(const char* s, unsigned int len){
+	if((s == NULL) && (len > 0)){
+		THROW_EXCEPTION(InvalidParameterException, "Parameter s is NULL ...");
+	}
+	m_str = s ? s : "";
+	m_length = len;
+}
+
+StringView::StringView(const String& s){
+	m_str = s.Str();
+	m_length = s.Length();
+}
+
+const char* StringView::Data() const{
+	return m_str;
+}
+
+unsigned int StringView::Length() const{
+	return m_length;
+}
+
+char StringView::operator [](unsigned int i) const{
+	if(i < m_length){
+		return m_str[i];
+	}
+	else{
+		THROW_EXCEPTION(IndexOutOfBoundsException, "Parameter i is invalid ...");
+	}
+}
+
+int StringView::_compare(const char* s, unsigned int len) const{
+	unsigned int n = (m_length < len) ? m_length : len;
+	int rst = (n > 0) ? memcmp(m_str, s, n) : 0;
+
+	if(rst == 0){
+		rst = (m_length < len) ? -1 : ((m_length > len) ? 1 : 0);
+	}
+	return rst;
+}
+
+bool StringView::operator == (const StringView& s) const{
+	//长度不同一定不相等，无需比较内容
+	return (m_length == s.m_length) && (memcmp(m_str, s.m_str, m_length) == 0);
+}
+
+bool StringView::operator != (const StringView& s) const{
+	return !(*this == s);
+}
+
+bool StringView::operator > (const StringView& s) const{
+	return _compare(s.m_str, s.m_length) > 0;
+}
+
+bool StringView::operator < (const StringView& s) const{
+	return _compare(s.m_str, s.m_length) < 0;
+}
+
+bool StringView::operator >= (const StringView& s) const{
+	return _compare(s.m_str, s.m_length) >= 0;
+}
+
+bool StringView::operator <= (const StringView& s) const{
+	return _compare(s.m_str, s.m_length) <= 0;
+}
+
+bool StringView::StartWith(const StringView& s) const{
+	return (s.m_length <= m_length) && (memcmp(m_str, s.m_str, s.m_length) == 0);
+}
+
+bool StringView::EndOf(const StringView& s) const{
+	return (s.m_length <= m_length) && (memcmp(m_str + m_length - s.m_length, s.m_str, s.m_length) == 0);
+}
+
+int StringView::IndexOf(const StringView& s) const{
+	return StringSearch::Find(m_str, m_length, s.m_str, s.m_length);
+}
+
+StringView StringView::Sub(int i, unsigned int len) const{
+	if((i >= 0) && (static_cast<unsigned int>(i) < m_length)){
+		//超过视图长度的部分忽视掉
+		len = (len < m_length - i) ? len : m_length - i;
+
+		return StringView(m_str + i, len);
+	}
+	else{
+		THROW_EXCEPTION(IndexOutOfBoundsException, "Parameter i is invalid ...");
+	}
+}
+
+StringView StringView::Trim() const{
+	unsigned int start = 0;
+	unsigned int end = m_length;
+
+	while(start < end && m_str[start] == ' ') start++;
+	while(end > start && m_str[end - 1] == ' ') end--;
+
+	return StringView(m_str + start, end - start);
+}
+
+StringTokenizer StringView::Split(const StringView& delim) const{
+	return StringTokenizer(*this, delim, StringTokenizer::SPLIT);
+}
+
+StringTokenizer StringView::Tokenize(const StringView& charset) const{
+	return StringTokenizer(*this, charset, StringTokenizer::TOKENIZE);
+}
+
+unsigned long long StringView::Hash() const{
+	//Hash是成员函数的名字，需要指明命名空间
+	return YzcLib::Hash::Bytes(m_str, m_length);
+}
+
+String StringView::ToString() const{
+	return String(m_str, m_length);
+}
+
+std::ostream& operator <<(std::ostream& out, const StringView& s){
+	out.write(s.m_str, s.m_length);
+	return out;
+}
+
+}
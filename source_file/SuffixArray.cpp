@@ -0,0 +1,491 @@
+#include "./../head_file/SuffixArray.h"
+#include "./../head_file/Sort.h"
+//malloc,free
+#include <cstdlib>
+#include <cstring>
+#include <cstdio>
+#include "./../head_file/Exception.h"
+
+//POSIX系统上通过mmap映射文件
+#if defined(__unix__) || defined(__APPLE__)
+#define SUFFIXARRAY_MMAP
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+namespace YzcLib{
+
+//文本长度的上限，下标使用int
+static const unsigned int SUFFIXARRAY_MAX = 0x7FFFFFFF;
+
+/*
+SA-IS，s[0, n)中每个元素的取值范围为[0, upper]，结果写入sa[0, n)
+	顶层的s为文本（unsigned char），递归时为LMS子串的编号（int），因此写成模板
+	不使用哨兵字符，最后一个后缀按L型处理（与不存在的空后缀相比更大）
+*/
+template <typename T>
+static void _sais(const T* s, int* sa, int n, int upper){
+	if(n == 1){
+		sa[0] = 0;
+		return;
+	}
+	if(n == 2){
+		sa[0] = (s[0] < s[1]) ? 0 : 1;
+		sa[1] = 1 - sa[0];
+		return;
+	}
+
+	//ls[i]为1表示后缀i为S型
+	DynamicArray<unsigned char> type(n);
+	unsigned char* ls = type.GetArray();
+	ls[n - 1] = 0;
+	for(int i = n - 2; i >= 0; i--){
+		ls[i] = (s[i] == s[i + 1]) ? ls[i + 1] : (s[i] < s[i + 1]);
+	}
+
+	/*
+	桶：首字符为c的后缀中，L型在前，S型在后
+		sum_l[c]	首字符为c的L型后缀在SA中的起始位置
+		sum_s[c]	首字符为c的S型后缀在SA中的起始位置
+	S型后缀的首字符一定小于upper，sum_l[c + 1]不会越界
+	*/
+	DynamicArray<int> suml(upper + 1);
+	DynamicArray<int> sums(upper + 1);
+	DynamicArray<int> bucket(upper + 1);
+	int* sum_l = suml.GetArray();
+	int* sum_s = sums.GetArray();
+	int* buf = bucket.GetArray();
+	for(int c = 0; c <= upper; c++){
+		sum_l[c] = 0;
+		sum_s[c] = 0;
+	}
+	for(int i = 0; i < n; i++){
+		if(!ls[i]){
+			sum_s[s[i]]++;
+		}
+		else{
+			sum_l[s[i] + 1]++;
+		}
+	}
+	for(int c = 0; c <= upper; c++){
+		sum_s[c] += sum_l[c];
+		if(c < upper){
+			sum_l[c + 1] += sum_s[c];
+		}
+	}
+
+	//LMS后缀：左边为L型的S型后缀，lms_map记录LMS后缀的编号，不是LMS后缀为-1
+	DynamicArray<int> lmsmap(n);
+	int* lms_map = lmsmap.GetArray();
+	int m = 0;
+	for(int i = 0; i < n; i++){
+		lms_map[i] = -1;
+	}
+	for(int i = 1; i < n; i++){
+		if(!ls[i - 1] && ls[i]){
+			lms_map[i] = m++;
+		}
+	}
+	DynamicArray<int> lmsarray(m);
+	int* lms = lmsarray.GetArray();
+	for(int i = 1, j = 0; i < n; i++){
+		if(!ls[i - 1] && ls[i]){
+			lms[j++] = i;
+		}
+	}
+
+	/*
+	诱导排序，order为LMS后缀的顺序（第一遍只要求首字符有序）
+		1.LMS后缀按order放入各自S桶
+		2.从左向右扫描，SA[i] - 1为L型时放入其L桶的头部（最后一个后缀一定是L型，最先放入）
+		3.从右向左扫描，SA[i] - 1为S型时放入其S桶的尾部（重新放置所有S型后缀）
+	*/
+	for(int pass = 0; pass < 2; pass++){
+		const int* order = lms;
+		DynamicArray<int> sorted(0);
+
+		if(pass == 1){
+			if(m == 0){
+				break;
+			}
+
+			//第一遍诱导排序之后，LMS子串在SA中按字典序排列，相同的子串相邻
+			sorted.resize(m);
+			int* sorted_lms = sorted.GetArray();
+			for(int i = 0, j = 0; i < n; i++){
+				if((sa[i] >= 0) && (lms_map[sa[i]] != -1)){
+					sorted_lms[j++] = sa[i];
+				}
+			}
+
+			//LMS子串编号，得到新串rec_s（按LMS后缀在文本中的顺序）
+			DynamicArray<int> recs(m);
+			int* rec_s = recs.GetArray();
+			int rec_upper = 0;
+			rec_s[lms_map[sorted_lms[0]]] = 0;
+			for(int i = 1; i < m; i++){
+				int l = sorted_lms[i - 1];
+				int r = sorted_lms[i];
+				int end_l = (lms_map[l] + 1 < m) ? lms[lms_map[l] + 1] : n;
+				int end_r = (lms_map[r] + 1 < m) ? lms[lms_map[r] + 1] : n;
+				bool same = (end_l - l == end_r - r);
+				if(same){
+					while((l < end_l) && (s[l] == s[r])){
+						l++;
+						r++;
+					}
+					same = (l != n) && (s[l] == s[r]);
+				}
+				if(!same){
+					rec_upper++;
+				}
+				rec_s[lms_map[sorted_lms[i]]] = rec_upper;
+			}
+
+			//递归得到LMS后缀的顺序，sorted_lms的空间可以复用
+			DynamicArray<int> recsa(m);
+			int* rec_sa = recsa.GetArray();
+			if(rec_upper + 1 == m){
+				for(int i = 0; i < m; i++){
+					rec_sa[rec_s[i]] = i;
+				}
+			}
+			else{
+				_sais(rec_s, rec_sa, m, rec_upper);
+			}
+			for(int i = 0; i < m; i++){
+				sorted_lms[i] = lms[rec_sa[i]];
+			}
+			order = sorted_lms;
+		}
+
+		for(int i = 0; i < n; i++){
+			sa[i] = -1;
+		}
+		memcpy(buf, sum_s, sizeof(int) * (upper + 1));
+		for(int i = 0; i < m; i++){
+			sa[buf[s[order[i]]]++] = order[i];
+		}
+
+		memcpy(buf, sum_l, sizeof(int) * (upper + 1));
+		sa[buf[s[n - 1]]++] = n - 1;
+		for(int i = 0; i < n; i++){
+			int v = sa[i];
+			if((v >= 1) && !ls[v - 1]){
+				sa[buf[s[v - 1]]++] = v - 1;
+			}
+		}
+
+		memcpy(buf, sum_l, sizeof(int) * (upper + 1));
+		for(int i = n - 1; i >= 0; i--){
+			int v = sa[i];
+			if((v >= 1) && ls[v - 1]){
+				sa[--buf[s[v - 1] + 1]] = v - 1;
+			}
+		}
+	}
+}
+
+SuffixArray::SuffixArray(){
+	m_text = "";
+	m_length = 0;
+	m_buf = NULL;
+	m_map = NULL;
+	m_map_size = 0;
+}
+
+SuffixArray::SuffixArray(const StringView& text){
+	m_text = "";
+	m_length = 0;
+	m_buf = NULL;
+	m_map = NULL;
+	m_map_size = 0;
+
+	Build(text);
+}
+
+void SuffixArray::_clear(){
+	free(m_buf);
+#ifdef SUFFIXARRAY_MMAP
+	if(m_map != NULL){
+		munmap(m_map, m_map_size);
+	}
+#endif
+	m_text = "";
+	m_length = 0;
+	m_buf = NULL;
+	m_map = NULL;
+	m_map_size = 0;
+}
+
+void SuffixArray::_build(){
+	m_sa.resize(m_length);
+	m_lcp.resize(m_length);
+
+	if(m_length > 0){
+		_sais(reinterpret_cast<const unsigned char*>(m_text), m_sa.GetArray(), m_length, 255);
+		_kasai();
+	}
+}
+
+void SuffixArray::_kasai(){
+	const unsigned char* s = reinterpret_cast<const unsigned char*>(m_text);
+	const int* sa = m_sa.GetArray();
+	int* lcp = m_lcp.GetArray();
+	int n = m_length;
+
+	DynamicArray<int> rankarray(n);
+	int* rank = rankarray.GetArray();
+	for(int i = 0; i < n; i++){
+		rank[sa[i]] = i;
+	}
+
+	//按后缀在文本中的顺序计算，后缀i + 1与其前驱的LCP不小于h - 1
+	int h = 0;
+	lcp[0] = 0;
+	for(int i = 0; i < n; i++){
+		if(rank[i] == 0){
+			h = 0;
+			continue;
+		}
+		int j = sa[rank[i] - 1];
+		while((i + h < n) && (j + h < n) && (s[i + h] == s[j + h])){
+			h++;
+		}
+		lcp[rank[i]] = h;
+		if(h > 0){
+			h--;
+		}
+	}
+}
+
+void SuffixArray::Build(const StringView& text){
+	if(text.Length() > SUFFIXARRAY_MAX){
+		THROW_EXCEPTION(InvalidParameterException, "Text is too long for SuffixArray ...");
+	}
+
+	//先拷贝一份，text可能指向自身的文本
+	char* buf = reinterpret_cast<char*>(malloc(text.Length() + 1));
+	if(buf == NULL){
+		THROW_EXCEPTION(NotEnoughMemoryException, "No memory to copy text in SuffixArray ...");
+	}
+	memcpy(buf, text.Data(), text.Length());
+	buf[text.Length()] = '\0';
+
+	_clear();
+	m_buf = buf;
+	m_text = buf;
+	m_length = text.Length();
+
+	_build();
+}
+
+void SuffixArray::BuildFromFile(const char* path){
+	if(path == NULL){
+		THROW_EXCEPTION(InvalidParameterException, "Path can not be NULL ...");
+	}
+
+	//先打开、映射（或读入）到局部变量，成功之后才替换原来的文本，失败时原来的索引保持不变
+	const char* text = "";
+	unsigned int length = 0;
+	char* buf = NULL;
+	void* map = NULL;
+	size_t map_size = 0;
+
+#ifdef SUFFIXARRAY_MMAP
+	int fd = open(path, O_RDONLY);
+	if(fd < 0){
+		THROW_EXCEPTION(InvalidParameterException, "Can not open file ...");
+	}
+
+	struct stat st;
+	if((fstat(fd, &st) != 0) || (static_cast<unsigned long long>(st.st_size) > SUFFIXARRAY_MAX)){
+		close(fd);
+		THROW_EXCEPTION(InvalidParameterException, "Can not get size of file or file is too large ...");
+	}
+
+	//空文件不能映射
+	if(st.st_size > 0){
+		map = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+		if(map == MAP_FAILED){
+			close(fd);
+			THROW_EXCEPTION(NotEnoughMemoryException, "Can not map file into memory ...");
+		}
+		map_size = st.st_size;
+		text = reinterpret_cast<const char*>(map);
+		length = st.st_size;
+	}
+	close(fd);
+#else
+	FILE* fp = fopen(path, "rb");
+	if(fp == NULL){
+		THROW_EXCEPTION(InvalidParameterException, "Can not open file ...");
+	}
+
+	long size = -1;
+	if(fseek(fp, 0, SEEK_END) == 0){
+		size = ftell(fp);
+		rewind(fp);
+	}
+	if((size < 0) || (static_cast<unsigned long>(size) > SUFFIXARRAY_MAX)){
+		fclose(fp);
+		THROW_EXCEPTION(InvalidParameterException, "Can not get size of file or file is too large ...");
+	}
+
+	buf = reinterpret_cast<char*>(malloc(size + 1));
+	if(buf == NULL){
+		fclose(fp);
+		THROW_EXCEPTION(NotEnoughMemoryException, "No memory to read file in SuffixArray ...");
+	}
+	size = fread(buf, 1, size, fp);
+	buf[size] = '\0';
+	fclose(fp);
+
+	text = buf;
+	length = size;
+#endif
+
+	_clear();
+	m_buf = buf;
+	m_map = map;
+	m_map_size = map_size;
+	m_text = text;
+	m_length = length;
+
+	_build();
+}
+
+int SuffixArray::_compare(const StringView& p, unsigned int i, unsigned int& k) const{
+	const unsigned char* s = reinterpret_cast<const unsigned char*>(m_text) + m_sa.GetArray()[i];
+	const unsigned char* t = reinterpret_cast<const unsigned char*>(p.Data());
+	unsigned int rest = m_length - m_sa.GetArray()[i];
+	unsigned int m = p.Length();
+
+	while((k < m) && (k < rest) && (t[k] == s[k])){
+		k++;
+	}
+
+	int rst = 0;
+	if(k == m){
+		//p是后缀的前缀
+		rst = 0;
+	}
+	else if(k == rest){
+		//后缀是p的真前缀，后缀更小
+		rst = 1;
+	}
+	else{
+		rst = (t[k] < s[k]) ? -1 : 1;
+	}
+	return rst;
+}
+
+void SuffixArray::_range(const StringView& p, unsigned int& lo, unsigned int& hi) const{
+	/*
+	lk、rk为p与左右边界外侧的后缀（SA[l - 1]、SA[r]）的公共前缀长度
+	两个边界之间的后缀都至少与p有min(lk, rk)个相同的字符
+	*/
+	unsigned int l = 0;
+	unsigned int r = m_length;
+	unsigned int lk = 0;
+	unsigned int rk = 0;
+
+	//第一个不小于p的后缀（以p开头视为相等）
+	while(l < r){
+		unsigned int mid = l + (r - l) / 2;
+		unsigned int k = (lk < rk) ? lk : rk;
+		if(_compare(p, mid, k) <= 0){
+			r = mid;
+			rk = k;
+		}
+		else{
+			l = mid + 1;
+			lk = k;
+		}
+	}
+	lo = l;
+
+	//第一个大于p（并且不以p开头）的后缀
+	r = m_length;
+	rk = 0;
+	while(l < r){
+		unsigned int mid = l + (r - l) / 2;
+		unsigned int k = (lk < rk) ? lk : rk;
+		if(_compare(p, mid, k) < 0){
+			r = mid;
+			rk = k;
+		}
+		else{
+			l = mid + 1;
+			lk = k;
+		}
+	}
+	hi = l;
+}
+
+StringView SuffixArray::Text() const{
+	return StringView(m_text, m_length);
+}
+
+unsigned int SuffixArray::Length() const{
+	return m_length;
+}
+
+int SuffixArray::Suffix(unsigned int i) const{
+	if(i < m_length){
+		return m_sa.GetArray()[i];
+	}
+	else{
+		THROW_EXCEPTION(IndexOutOfBoundsException, "Parameter i is invalid ...");
+	}
+}
+
+int SuffixArray::Lcp(unsigned int i) const{
+	if(i < m_length){
+		return m_lcp.GetArray()[i];
+	}
+	else{
+		THROW_EXCEPTION(IndexOutOfBoundsException, "Parameter i is invalid ...");
+	}
+}
+
+unsigned int SuffixArray::Count(const StringView& p) const{
+	unsigned int lo = 0;
+	unsigned int hi = 0;
+	_range(p, lo, hi);
+	return hi - lo;
+}
+
+bool SuffixArray::Contains(const StringView& p) const{
+	return Count(p) > 0;
+}
+
+SharedPointer<Array<int>> SuffixArray::Locate(const StringView& p) const{
+	unsigned int lo = 0;
+	unsigned int hi = 0;
+	_range(p, lo, hi);
+
+	DynamicArray<int>* rst = new DynamicArray<int>(hi - lo);
+	if(rst != NULL){
+		int* pos = rst->GetArray();
+		for(unsigned int i = lo; i < hi; i++){
+			pos[i - lo] = m_sa.GetArray()[i];
+		}
+		//周期性文本中SA的顺序接近逆序，使用不递归、最坏O(k * log(k))的归并排序
+		if(hi - lo > 1){
+			Sort::Merge_Sort(pos, hi - lo, Sort::INCREASING);
+		}
+	}
+	else{
+		THROW_EXCEPTION(NotEnoughMemoryException, "No memory to create result array ...");
+	}
+	return rst;
+}
+
+SuffixArray::~SuffixArray(){
+	_clear();
+}
+
+}